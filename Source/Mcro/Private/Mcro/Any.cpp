@@ -15,47 +15,80 @@ namespace Mcro::Any
 {
 	FAny::FAny(FAny const& other)
 	{
-		if (other.IsValid())
-			other.CopyConstruct(this, other);
+		CopyFrom(other);
 	}
 
 	FAny::FAny(FAny&& other)
-		: Storage(other.Storage)
-		, MainType(MoveTemp(other.MainType))
-		, Destruct(MoveTemp(other.Destruct))
-		, CopyConstruct(MoveTemp(other.CopyConstruct))
-		, ValidTypes(MoveTemp(other.ValidTypes))
 	{
-		other.Reset();
+		MoveFrom(other);
 	}
 
 	FAny::~FAny()
 	{
-		if (static_cast<bool>(Destruct))
-			Destruct(this);
-		Reset();
+		Destroy();
+	}
+
+	FAny& FAny::operator = (FAny const& other)
+	{
+		if (this == &other) return *this;
+		Destroy();
+		CopyFrom(other);
+		return *this;
+	}
+
+	FAny& FAny::operator = (FAny&& other)
+	{
+		if (this == &other) return *this;
+		Destroy();
+		MoveFrom(other);
+		return *this;
 	}
 	
-	void FAny::AddAlias(FType const& alias)
+	void FAny::AddAlias(FTypeHash alias)
 	{
-		if (!ValidTypes.Contains(alias))
-			ValidTypes.Add(alias);
+		if (!IsValidAs(alias))
+			Aliases.Add(alias);
 	}
 
-	void FAny::CopyTypeInfo(FAny* self, const FAny* other)
+	void FAny::CopyFrom(FAny const& other)
 	{
-		self->MainType = other->MainType;
-		self->ValidTypes = other->ValidTypes;
-		self->CopyConstruct = other->CopyConstruct;
-		self->Destruct = other->Destruct;
+		if (!other.IsValid()) return;
+		
+		MainType = other.MainType;
+		Aliases = other.Aliases;
+		Operations = other.Operations;
+		Facilities = other.Facilities;
+		Operations->CopyConstruct(*this, other);
+	}
+
+	void FAny::MoveFrom(FAny& other)
+	{
+		MainType = other.MainType;
+		Aliases = MoveTemp(other.Aliases);
+		Operations = other.Operations;
+		Facilities = MoveTemp(other.Facilities);
+		
+		if (IsInline())
+			Operations->Relocate(*this, other);
+		else
+			HeapStorage = other.HeapStorage;
+		
+		other.Reset();
+	}
+
+	void FAny::Destroy()
+	{
+		if (IsValid())
+			Operations->Destruct(*this);
+		Reset();
 	}
 
 	void FAny::Reset()
 	{
-		Storage = nullptr;
-		MainType = {};
-		Destruct.Reset();
-		CopyConstruct.Reset();
-		ValidTypes.Empty();
+		HeapStorage = nullptr;
+		Operations = nullptr;
+		Facilities.Reset();
+		MainType = nullptr;
+		Aliases.Reset();
 	}
-}
+}
\ No newline at end of file
@@ -11,6 +11,7 @@
 
 #include "Mcro/AssertMacros.h"
 
+#include "Containers/Ticker.h"
 #include "Mcro/Error.h"
 #include "Mcro/Error/ErrorManager.h"
 #include "Mcro/TextMacros.h"
@@ -19,22 +20,175 @@
 #include "Editor.h"
 #endif
 
+DECLARE_LOG_CATEGORY_CLASS(LogAssertMacros, Log, Log);
+
 namespace Mcro::AssertMacros::Detail
 {
+	namespace
+	{
+		/** Call-sites with suppressed failures, which are flushed periodically on the core ticker */
+		class FSuppressedSites
+		{
+		public:
+			static FSuppressedSites& Get()
+			{
+				// Leaked on purpose, so call-sites (function local statics) can unregister during static destruction
+				static FSuppressedSites* instance = new FSuppressedSites();
+				return *instance;
+			}
+
+			void Add(FAssertSite* site)
+			{
+				FScopeLock lock(&Mutex);
+				Sites.Add(site);
+				if (!TickerHandle.IsValid())
+				{
+					TickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+						FTickerDelegate::CreateRaw(this, &FSuppressedSites::Flush),
+						MCRO_ASSERT_MIN_REPORT_INTERVAL
+					);
+				}
+			}
+
+			void Remove(FAssertSite* site)
+			{
+				FScopeLock lock(&Mutex);
+				Sites.Remove(site);
+			}
+
+		private:
+			bool Flush(float)
+			{
+				// Reports are broadcast after unlocking, as their listeners may fail assertions themselves
+				TArray<IErrorPtr, TInlineAllocator<4>> reports;
+				bool keepTicking = true;
+				{
+					FScopeLock lock(&Mutex);
+					const double now = FPlatformTime::Seconds();
+					for (auto it = Sites.CreateIterator(); it; ++it)
+					{
+						IErrorPtr report;
+						if ((*it)->FlushSuppressed(now, &report)) it.RemoveCurrent();
+						if (report) reports.Add(report);
+					}
+					if (Sites.IsEmpty())
+					{
+						TickerHandle.Reset();
+						keepTicking = false;
+					}
+				}
+				for (IErrorPtr const& report : reports)
+					report->Report();
+				
+				return keepTicking;
+			}
+
+			FCriticalSection Mutex;
+			TSet<FAssertSite*> Sites;
+			FTSTicker::FDelegateHandle TickerHandle;
+		};
+	}
+	
+	FAssertSite::FAssertSite(std::source_location const& location)
+		: Location(location)
+	{}
+
+	FAssertSite::~FAssertSite()
+	{
+		FSuppressedSites::Get().Remove(this);
+	}
+
+	bool FAssertSite::ShouldSubmit(EErrorSeverity severity)
+	{
+		TotalFailures.fetch_add(1, std::memory_order_relaxed);
+		if (severity >= EErrorSeverity::Crashing) return true;
+		
+		// Fatal failures stop PIE (or crash), they're only throttled while PIE is already stopping
+		if (severity >= EErrorSeverity::Fatal && !IsEndingPIE()) return true;
+
+		const double now = FPlatformTime::Seconds();
+		double next = NextSubmitTime.load(std::memory_order_relaxed);
+
+		// Only one thread may claim the submission of a report window
+		if (severity < EErrorSeverity::Fatal
+			&& now >= next
+			&& NextSubmitTime.compare_exchange_strong(next, now + Interval.load(std::memory_order_relaxed))
+		) {
+			return true;
+		}
+		
+		SuppressedSeverity.store(severity, std::memory_order_relaxed);
+		
+		// Only the first suppressed failure is logged, the rest are counted and reported together later
+		if (Suppressed.fetch_add(1, std::memory_order_relaxed) == 0)
+		{
+			FSuppressedSites::Get().Add(this);
+			UE_LOG(LogAssertMacros, Warning,
+				TEXT_"Assertion failed again at %hs:%d (error reports of this assertion are throttled)",
+				Location.file_name(), Location.line()
+			);
+		}
+		return false;
+	}
+
+	bool FAssertSite::FlushSuppressed(double now, IErrorPtr* deferredReport)
+	{
+		if (Suppressed.load(std::memory_order_relaxed) == 0) return true;
+		if (now < NextSubmitTime.load(std::memory_order_relaxed)) return false;
+
+		const int32 suppressed = ConsumeSuppressed();
+		if (suppressed > 0)
+		{
+			UE_LOG(LogAssertMacros, Warning,
+				TEXT_"%d failures of the assertion at %hs:%d were not reported in detail (%llu in total).",
+				suppressed, Location.file_name(), Location.line(), GetTotalFailures()
+			);
+			
+			IErrorRef report = IError::Make(new FAssertion())
+				->WithSeverity(SuppressedSeverity.load(std::memory_order_relaxed))
+				->WithMessageF(TEXT_"{0} failures of an assertion were not reported in detail ({1} in total).",
+					suppressed, GetTotalFailures()
+				)
+				->WithLocation(Location);
+			
+			if (deferredReport) *deferredReport = report;
+			else report->Report();
+		}
+		return true;
+	}
+
+	int32 FAssertSite::ConsumeSuppressed()
+	{
+		const int32 suppressed = Suppressed.exchange(0, std::memory_order_relaxed);
+		Interval.store(
+			suppressed > 0
+				? FMath::Min(Interval.load(std::memory_order_relaxed) * 2.0, MCRO_ASSERT_MAX_REPORT_INTERVAL)
+				: MCRO_ASSERT_MIN_REPORT_INTERVAL,
+			std::memory_order_relaxed
+		);
+		return suppressed;
+	}
+
 	void SubmitError(
+		FAssertSite& site,
 		EErrorSeverity severity,
 		FString const& codeContext,
 		bool async, bool important,
-		TUniqueFunction<void(IErrorRef const&)>&& extraSetup,
-		std::source_location const& location
+		TUniqueFunction<void(IErrorRef const&)>&& extraSetup
 	) {
+		const int32 suppressed = site.ConsumeSuppressed();
 		auto error = IError::Make(new FAssertion())
 			->WithSeverity(severity)
 			->WithMessage(TEXT_"Program has hit an assertion")
 			->WithCodeContext(codeContext)
 			->WithCppStackTrace({}, true, 1)
-			->WithLocation(location)
-			->WithBlueprintStackTrace({}, IsInGameThread());
+			->WithLocation(site.Location)
+			->WithBlueprintStackTrace({}, IsInGameThread())
+			->WithAppendixFC(suppressed > 0,
+				TEXT_"Suppressed",
+				TEXT_"{0} identical failures were suppressed since the last report ({1} in total).",
+				suppressed, site.GetTotalFailures()
+			);
 		
 		extraSetup(error);
 		auto future = FErrorManager::Get().DisplayError(error,
@@ -51,6 +205,11 @@ namespace Mcro::AssertMacros::Detail
 		return GEditor && GEditor->PlayWorld != nullptr;
 	}
 
+	bool IsEndingPIE()
+	{
+		return IsRunningPIE() && GEditor->ShouldEndPlayMap();
+	}
+
 	void StopPie()
 	{
 		if (IsRunningPIE()) GEditor->RequestEndPlayMap();
@@ -59,6 +218,7 @@ namespace Mcro::AssertMacros::Detail
 #else
 	
 	bool IsRunningPIE() { return false; }
+	bool IsEndingPIE() { return false; }
 	void StopPie() {}
 
 #endif
@@ -10,108 +10,237 @@
  */
 
 #include "Mcro/Composition.h"
+#include "Mcro/Composition/Registry.h"
+
+#include "Algo/BinarySearch.h"
 
 namespace Mcro::Composition
 {
+	namespace Detail
+	{
+		FComponentStorage::FComponentStorage(FComponentStorage&& other) noexcept
+			: Pages(MoveTemp(other.Pages))
+		{
+			other.Pages.Empty();
+		}
+
+		FComponentStorage& FComponentStorage::operator = (FComponentStorage&& other) noexcept
+		{
+			if (this != &other)
+			{
+				Empty();
+				Pages = MoveTemp(other.Pages);
+				other.Pages.Empty();
+			}
+			return *this;
+		}
+
+		FComponentStorage::~FComponentStorage()
+		{
+			Empty();
+		}
+
+		void FComponentStorage::Reserve(int32 count)
+		{
+			if (count <= 0) return;
+			if (Pages.IsEmpty() || Pages.Last().Capacity - Pages.Last().Num < count)
+				AddPage(count);
+		}
+
+		void FComponentStorage::Empty()
+		{
+			for (FPage& page : Pages)
+			{
+				for (int32 i = 0; i < page.Num; ++i)
+					page.Items[i].~FAny();
+				FMemory::Free(page.Items);
+			}
+			Pages.Empty();
+		}
+
+		void FComponentStorage::AddPage(int32 capacity)
+		{
+			Pages.Add({
+				.Items = static_cast<FAny*>(FMemory::Malloc(sizeof(FAny) * capacity, alignof(FAny))),
+				.Num = 0,
+				.Capacity = capacity
+			});
+		}
+
+		FAny* FComponentStorage::AllocateSlot()
+		{
+			if (Pages.IsEmpty() || Pages.Last().Num == Pages.Last().Capacity)
+			{
+				// Grow geometrically so components added one by one still end up in a few pages
+				int32 stored = 0;
+				for (FPage const& page : Pages) stored += page.Capacity;
+				AddPage(FMath::Max(MinPageCapacity, stored));
+			}
+			FPage& page = Pages.Last();
+			return page.Items + page.Num++;
+		}
+	}
+	
 	IComposable::IComposable(const IComposable& other)
 		: LastAddedComponentHash(other.LastAddedComponentHash)
 		, Components(other.Components)
-		, ComponentLogistics(other.ComponentLogistics)
 		, ComponentAliases(other.ComponentAliases)
+		, bCopyOnWrite(other.bCopyOnWrite)
 		, OnComponentAdded(other.OnComponentAdded)
 	{
+		// Shared components are referenced by the copied table, the rest is copied into a single page
+		int32 ownedComponents = 0;
+		for (FComponentEntry const& entry : Components)
+			if (!entry.IsShared()) ++ownedComponents;
+		
+		ComponentStorage.Reserve(ownedComponents);
+		for (FComponentEntry& entry : Components)
+		{
+			if (!entry.IsShared())
+				entry.Component = &ComponentStorage.Emplace(*entry.Component);
+		}
 		NotifyCopyComponents(other);
 	}
 
 	IComposable::IComposable(IComposable&& other) noexcept
 		: LastAddedComponentHash(other.LastAddedComponentHash)
 		, Components(MoveTemp(other.Components))
-		, ComponentLogistics(MoveTemp(other.ComponentLogistics))
 		, ComponentAliases(MoveTemp(other.ComponentAliases))
+		, ComponentStorage(MoveTemp(other.ComponentStorage))
+		, bCopyOnWrite(other.bCopyOnWrite)
 		, OnComponentAdded(MoveTemp(other.OnComponentAdded))
 	{
+		// Take over the registration before the moved-from composable is reset, so it's not re-indexed as empty
+		if (other.RegistryLink.Registry)
+			other.RegistryLink.Registry->Relink(other, *this);
 		NotifyMoveComponents(FWD(other));
 	}
 
-	bool IComposable::HasExactComponent(FTypeHash typeHash) const
+	IComposable::~IComposable()
 	{
-		return Components.Contains(typeHash);
+		if (RegistryLink.Registry) RegistryLink.Registry->Unregister(*this);
 	}
 
-	bool IComposable::HasComponentAliasUnchecked(FTypeHash typeHash) const
+	int32 IComposable::FindComponentIndex(FTypeHash typeHash) const
 	{
-		return ComponentAliases.Contains(typeHash);
+		return Algo::BinarySearchBy(Components, typeHash, &FComponentEntry::Type);
 	}
 
-	bool IComposable::HasComponentAlias(FTypeHash typeHash) const
+	int32 IComposable::GetComponentInsertIndex(FTypeHash typeHash) const
 	{
-		if (HasComponentAliasUnchecked(typeHash))
+		return Algo::LowerBoundBy(Components, typeHash, &FComponentEntry::Type);
+	}
+
+	TArrayView<const IComposable::FComponentAlias> IComposable::GetAliasSpan(FTypeHash typeHash) const
+	{
+		const int32 first = Algo::LowerBoundBy(ComponentAliases, typeHash, &FComponentAlias::Alias);
+		const int32 last = Algo::UpperBoundBy(ComponentAliases, typeHash, &FComponentAlias::Alias);
+		return TArrayView<const FComponentAlias>(ComponentAliases).Slice(first, last - first);
+	}
+
+	void IComposable::OnComponentInserted(int32 index)
+	{
+		for (FComponentAlias& alias : ComponentAliases)
 		{
-			auto& components = ComponentAliases[typeHash];
-			components.RemoveAll([this](FTypeHash i)
-			{
-				return !Components.Contains(i);
-			});
-			if (components.IsEmpty())
-			{
-				ComponentAliases.Remove(typeHash);
-				return false;
-			}
-			return true;
+			if (alias.Index >= index) ++alias.Index;
 		}
-		return false;
+		if (bCopyOnWrite) Components[index].Share();
+	}
+
+	void IComposable::DetachComponents(FTypeHash typeHash)
+	{
+		const int32 index = FindComponentIndex(typeHash);
+		if (index != INDEX_NONE) Components[index].Detach();
+		
+		for (FComponentAlias const& alias : GetAliasSpan(typeHash))
+			Components[alias.Index].Detach();
+	}
+
+	void IComposable::EnableCopyOnWrite()
+	{
+		bCopyOnWrite = true;
+		for (FComponentEntry& entry : Components)
+			entry.Share();
+	}
+
+	bool IComposable::HasExactComponent(FTypeHash typeHash) const
+	{
+		return FindComponentIndex(typeHash) != INDEX_NONE;
+	}
+
+	bool IComposable::HasComponentAlias(FTypeHash typeHash) const
+	{
+		return !GetAliasSpan(typeHash).IsEmpty();
 	}
 
 	void IComposable::AddComponentAlias(FTypeHash mainType, FTypeHash validAs)
 	{
-		if (HasComponentAliasUnchecked(validAs))
-			ComponentAliases[validAs].Add(mainType);
-		else ComponentAliases.Add(validAs, { mainType });
+		const int32 index = FindComponentIndex(mainType);
+		if (index == INDEX_NONE) return;
+		
+		for (FComponentAlias const& alias : GetAliasSpan(validAs))
+		{
+			if (alias.Index == index) return;
+		}
+		
+		const int32 insertAt = Algo::UpperBoundBy(ComponentAliases, validAs, &FComponentAlias::Alias);
+		ComponentAliases.Insert(FComponentAlias { .Alias = validAs, .Index = index }, insertAt);
 	}
 
 	void IComposable::NotifyCopyComponents(IComposable const& other)
 	{
-		for (auto const& [key, logistics] : ComponentLogistics)
+		for (int32 i = 0; i < Components.Num(); ++i)
 		{
-			logistics.Copy(this, other.Components[key]);
+			FComponentEntry& entry = Components[i];
+			if (entry.Logistics.Copy)
+				entry.Logistics.Copy(this, *entry.Get(), *other.Components[i].Get());
 		}
 	}
 
 	void IComposable::NotifyMoveComponents(IComposable&& other)
 	{
 		if (this == &other) return;
-		for (auto const& [key, logistics] : ComponentLogistics)
+		for (FComponentEntry& entry : Components)
 		{
-			logistics.Move(this);
+			if (entry.Logistics.Move)
+				entry.Logistics.Move(this, *entry.Get());
 		}
 		other.ResetComponents();
 	}
 
+	void IComposable::NotifyRegistry()
+	{
+		if (RegistryLink.Registry) RegistryLink.Registry->Update(*this);
+	}
+
 	void IComposable::ResetComponents()
 	{
 		Components.Empty();
-		ComponentLogistics.Empty();
 		ComponentAliases.Empty();
+		ComponentStorage.Empty();
 		LastAddedComponentHash = 0;
+		NotifyRegistry();
 	}
 
 	ranges::any_view<FAny*> IComposable::GetExactComponent(FTypeHash typeHash) const
 	{
 		namespace r = ranges;
 		namespace rv = ranges::views;
-			
-		if (HasExactComponent(typeHash)) return rv::single(Components.Find(typeHash));
-		return ranges::empty_view<FAny*>();
+
+		const int32 index = FindComponentIndex(typeHash);
+		if (index != INDEX_NONE) return rv::single(Components[index].Get());
+		return r::empty_view<FAny*>();
 	}
 
 	ranges::any_view<FAny*> IComposable::GetAliasedComponents(FTypeHash typeHash) const
 	{
 		namespace r = ranges;
 		namespace rv = ranges::views;
-			
-		if (HasComponentAlias(typeHash))
-			return ComponentAliases[typeHash]
-				| rv::transform([this](FTypeHash i) -> decltype(auto) { return Components.Find(i); });
+
+		auto aliases = GetAliasSpan(typeHash);
+		if (!aliases.IsEmpty())
+			return r::subrange(aliases.GetData(), aliases.GetData() + aliases.Num())
+				| rv::transform([this](FComponentAlias const& alias) { return Components[alias.Index].Get(); });
 			
 		return r::empty_view<FAny*>();
 	}
@@ -0,0 +1,235 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#include "Mcro/Composition/Registry.h"
+
+#include "Algo/BinarySearch.h"
+#include "Algo/Compare.h"
+
+namespace Mcro::Composition
+{
+	namespace Detail
+	{
+		using FSignature = TArray<FTypeHash, TInlineAllocator<32>>;
+		using FComponentIndices = TArray<int32, TInlineAllocator<32>>;
+
+		/** Merge the sorted component and alias tables of a composable class into a sorted signature */
+		void GetSignature(
+			TArrayView<const FComponentEntry> components,
+			TArrayView<const FComponentAlias> aliases,
+			FSignature& signature,
+			FComponentIndices& componentIndices
+		) {
+			int32 c = 0, a = 0;
+			while (c < components.Num() || a < aliases.Num())
+			{
+				FTypeHash next;
+				int32 componentIndex;
+				if (c < components.Num() && (a >= aliases.Num() || components[c].Type <= aliases[a].Alias))
+				{
+					next = components[c].Type;
+					componentIndex = c;
+					++c;
+				}
+				else
+				{
+					next = aliases[a].Alias;
+					componentIndex = aliases[a].Index;
+				}
+				while (a < aliases.Num() && aliases[a].Alias == next) ++a;
+
+				signature.Add(next);
+				componentIndices.Add(componentIndex);
+			}
+		}
+
+		FTypeHash GetQueryHash(TArrayView<const FTypeHash> required)
+		{
+			FTypeHash result = 0;
+			for (FTypeHash typeHash : required)
+				result = (result ^ typeHash) * 0x9E3779B97F4A7C15ull;
+			return result;
+		}
+	}
+
+	int32 FComposableArchetype::FindColumn(FTypeHash typeHash) const
+	{
+		return Algo::BinarySearch(Signature, typeHash);
+	}
+
+	FComposableRegistry::~FComposableRegistry()
+	{
+		for (FComposableArchetype& archetype : Archetypes)
+		{
+			for (IComposable* member : archetype.Members)
+			{
+				member->RegistryLink.Registry = nullptr;
+				member->RegistryLink.Archetype = INDEX_NONE;
+				member->RegistryLink.Row = INDEX_NONE;
+			}
+		}
+	}
+
+	void FComposableRegistry::Register(IComposable& composable)
+	{
+		if (composable.RegistryLink.Registry == this)
+		{
+			Update(composable);
+			return;
+		}
+		if (composable.RegistryLink.Registry)
+			composable.RegistryLink.Registry->Unregister(composable);
+
+		Detail::FSignature signature;
+		Detail::FComponentIndices componentIndices;
+		Detail::GetSignature(composable.Components, composable.ComponentAliases, signature, componentIndices);
+		AddRow(composable, FindOrAddArchetype(signature), componentIndices);
+	}
+
+	void FComposableRegistry::Unregister(IComposable& composable)
+	{
+		if (composable.RegistryLink.Registry != this) return;
+		RemoveRow(composable);
+		composable.RegistryLink.Registry = nullptr;
+	}
+
+	void FComposableRegistry::Relink(IComposable& from, IComposable& to)
+	{
+		if (from.RegistryLink.Registry != this || &from == &to) return;
+		if (to.RegistryLink.Registry)
+			to.RegistryLink.Registry->Unregister(to);
+
+		FComposableArchetype& archetype = Archetypes[from.RegistryLink.Archetype];
+		archetype.Members[from.RegistryLink.Row] = &to;
+		
+		to.RegistryLink.Registry = this;
+		to.RegistryLink.Archetype = from.RegistryLink.Archetype;
+		to.RegistryLink.Row = from.RegistryLink.Row;
+		
+		from.RegistryLink.Registry = nullptr;
+		from.RegistryLink.Archetype = INDEX_NONE;
+		from.RegistryLink.Row = INDEX_NONE;
+
+		// The component table of `to` may differ from the one it was registered with
+		Update(to);
+	}
+
+	void FComposableRegistry::Update(IComposable& composable)
+	{
+		if (composable.RegistryLink.Registry != this) return;
+
+		Detail::FSignature signature;
+		Detail::FComponentIndices componentIndices;
+		Detail::GetSignature(composable.Components, composable.ComponentAliases, signature, componentIndices);
+
+		FComposableArchetype& current = Archetypes[composable.RegistryLink.Archetype];
+		if (Algo::Compare(current.Signature, signature))
+		{
+			FMemory::Memcpy(
+				current.ComponentIndices.GetData() + composable.RegistryLink.Row * signature.Num(),
+				componentIndices.GetData(),
+				componentIndices.Num() * sizeof(int32)
+			);
+			return;
+		}
+		RemoveRow(composable);
+		AddRow(composable, FindOrAddArchetype(signature), componentIndices);
+	}
+
+	bool FComposableRegistry::IsRegistered(IComposable const& composable) const
+	{
+		return composable.RegistryLink.Registry == this;
+	}
+
+	int32 FComposableRegistry::Num() const
+	{
+		int32 result = 0;
+		for (FComposableArchetype const& archetype : Archetypes)
+			result += archetype.Num();
+		return result;
+	}
+
+	FComposableRegistry::FQuery const& FComposableRegistry::FindQuery(TArrayView<const FTypeHash> required)
+	{
+		auto& bucket = Queries.FindOrAdd(Detail::GetQueryHash(required));
+		for (TUniquePtr<FQuery> const& cached : bucket)
+		{
+			if (Algo::Compare(cached->Required, required))
+				return *cached;
+		}
+
+		FQuery& query = *bucket.Add_GetRef(MakeUnique<FQuery>());
+		query.Required = TArray<FTypeHash>(required);
+		for (int32 i = 0; i < Archetypes.Num(); ++i)
+		{
+			FComposableArchetype const& archetype = Archetypes[i];
+			TArray<int32, TInlineAllocator<16>> columns;
+			for (FTypeHash typeHash : required)
+			{
+				const int32 column = archetype.FindColumn(typeHash);
+				if (column == INDEX_NONE) break;
+				columns.Add(column);
+			}
+			if (columns.Num() < required.Num()) continue;
+
+			query.Archetypes.Add(i);
+			query.Columns.Append(columns);
+		}
+		return query;
+	}
+
+	int32 FComposableRegistry::FindOrAddArchetype(TArrayView<const FTypeHash> signature)
+	{
+		const int32 existing = Archetypes.IndexOfByPredicate([&](FComposableArchetype const& archetype)
+		{
+			return Algo::Compare(archetype.Signature, signature);
+		});
+		if (existing != INDEX_NONE) return existing;
+
+		// Cached queries only know about existing archetypes
+		Queries.Reset();
+		return Archetypes.Add({ .Signature = TArray<FTypeHash>(signature) });
+	}
+
+	void FComposableRegistry::AddRow(IComposable& composable, int32 archetypeIndex, TArrayView<const int32> componentIndices)
+	{
+		FComposableArchetype& archetype = Archetypes[archetypeIndex];
+		composable.RegistryLink.Registry = this;
+		composable.RegistryLink.Archetype = archetypeIndex;
+		composable.RegistryLink.Row = archetype.Members.Add(&composable);
+		archetype.ComponentIndices.Append(componentIndices);
+	}
+
+	void FComposableRegistry::RemoveRow(IComposable& composable)
+	{
+		FComposableArchetype& archetype = Archetypes[composable.RegistryLink.Archetype];
+		const int32 row = composable.RegistryLink.Row;
+		const int32 last = archetype.Members.Num() - 1;
+		const int32 stride = archetype.Signature.Num();
+
+		if (row != last)
+		{
+			IComposable* moved = archetype.Members[last];
+			archetype.Members[row] = moved;
+			moved->RegistryLink.Row = row;
+			FMemory::Memcpy(
+				archetype.ComponentIndices.GetData() + row * stride,
+				archetype.ComponentIndices.GetData() + last * stride,
+				stride * sizeof(int32)
+			);
+		}
+		archetype.Members.RemoveAt(last);
+		archetype.ComponentIndices.SetNum(last * stride);
+
+		composable.RegistryLink.Archetype = INDEX_NONE;
+		composable.RegistryLink.Row = INDEX_NONE;
+	}
+}
@@ -15,6 +15,7 @@
 #include "Mcro/Error/PlainTextComponent.h"
 #include "Mcro/Error/CppStackTrace.h"
 #include "Mcro/Error/BlueprintStackTrace.h"
+#include "Mcro/Error/ErrorSerializer.h"
 #include "Mcro/Text.h"
 #include "Mcro/Enums.h"
 #include "Mcro/FmtMacros.h"
@@ -70,6 +71,35 @@ namespace Mcro::Error
 		AddError(name, Make(new IPlainTextComponent())->WithMessage(text), type);
 	}
 
+	void IError::AddDeferredAppendix(const FString& name, FDeferredFormat&& text, const FString& type)
+	{
+		auto appendix = Make(new IPlainTextComponent());
+		appendix->DeferredMessage = MoveTemp(text);
+		appendix->bHasDeferredText = true;
+		AddError(name, appendix, type);
+	}
+
+	void IError::RenderDeferredText() const
+	{
+		// Most reads happen after the texts are rendered, those don't need to contend on the lock
+		if (!bHasDeferredText) return;
+		
+		FScopeLock lock(&RenderMutex.Get());
+		if (!bHasDeferredText) return;
+		
+		if (DeferredMessage.IsSet())
+		{
+			Message = FString::Format(DeferredMessage->Format, DeferredMessage->Arguments);
+			DeferredMessage.Reset();
+		}
+		if (DeferredDetails.IsSet())
+		{
+			Details = FString::Format(DeferredDetails->Format, DeferredDetails->Arguments);
+			DeferredDetails.Reset();
+		}
+		bHasDeferredText = false;
+	}
+
 	void IError::AddCppStackTrace(const FString& name, int32 numAdditionalStackFramesToIgnore, bool fastWalk)
 	{
 		AddError(name, Make(new FCppStackTrace(numAdditionalStackFramesToIgnore + 1, fastWalk)));
@@ -87,6 +117,8 @@ namespace Mcro::Error
 		
 		if (Severity > EErrorSeverity::ErrorComponent)
 			emitter << YAML::Key << "Severity" << YAML::Value << Severity;
+
+		RenderDeferredText();
 		
 		if (!Message.IsEmpty())
 			emitter << YAML::Key << "Message" << YAML::Value << YAML::Literal << Message;
@@ -98,6 +130,30 @@ namespace Mcro::Error
 			emitter << YAML::Key << "CodeContext" << YAML::Value << YAML::Literal << CodeContext;
 	}
 
+	void IError::SerializeFields(IErrorSerializer& serializer, bool isRoot) const
+	{
+		if (isRoot)
+		{
+			TStringBuilder<128> type;
+			TypeName.AppendString(type);
+			serializer.WriteField("Type", type.ToView());
+		}
+
+		if (Severity > EErrorSeverity::ErrorComponent)
+			serializer.WriteField("Severity", GetSeverityString());
+
+		RenderDeferredText();
+		
+		if (!Message.IsEmpty())
+			serializer.WriteField("Message", Message);
+		
+		if (!Details.IsEmpty())
+			serializer.WriteField("Details", Details);
+		
+		if (!CodeContext.IsEmpty())
+			serializer.WriteField("CodeContext", CodeContext);
+	}
+
 	void IError::NotifyState(Observable::IState<IErrorPtr>& state)
 	{
 		state.Set(SharedThis(this));
@@ -116,6 +172,20 @@ namespace Mcro::Error
 		}
 	}
 
+	void IError::Serialize(IErrorSerializer& serializer, FStringView name) const
+	{
+		serializer.BeginError(name);
+		SerializeFields(serializer, name.IsEmpty());
+
+		for (auto const& at : ErrorPropagation)
+			serializer.WritePropagation(at);
+
+		for (auto const& inner : InnerErrors)
+			inner.Value->Serialize(serializer, inner.Key);
+
+		serializer.EndError();
+	}
+
 	auto operator << (YAML::Emitter& emitter, IErrorRef const& error) -> YAML::Emitter&
 	{
 		error->SerializeYaml(emitter);
@@ -11,6 +11,7 @@
 
 #include "Mcro/Error/CppException.h"
 #include "Mcro/Error/SErrorDisplay.h"
+#include "Mcro/Error/ErrorSerializer.h"
 #include "Mcro/Yaml.h"
 
 namespace Mcro::Error
@@ -45,4 +46,10 @@ namespace Mcro::Error
 		emitter << YAML::Key << "ExceptionType" << YAML::Value << GetExceptionType();
 		IError::SerializeMembers(emitter);
 	}
+
+	void FCppException::SerializeFields(IErrorSerializer& serializer, bool isRoot) const
+	{
+		serializer.WriteField("ExceptionType", GetExceptionType());
+		IError::SerializeFields(serializer, isRoot);
+	}
 }
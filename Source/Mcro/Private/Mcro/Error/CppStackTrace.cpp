@@ -10,13 +10,69 @@
  */
 
 #include "Mcro/Error/CppStackTrace.h"
+#include "Mcro/Error/ErrorSerializer.h"
 #include "HAL/PlatformStackWalk.h"
+#include "Misc/ScopeRWLock.h"
 #include "Stats/StatsMisc.h"
+#include "Mcro/Yaml.h"
 
 namespace Mcro::Error
 {
+	namespace
+	{
+		/** Program counters are resolved to the same symbols for the lifetime of the process */
+		class FSymbolCache
+		{
+		public:
+			static FSymbolCache& Get()
+			{
+				static FSymbolCache instance;
+				return instance;
+			}
+
+			FString Resolve(uint64 programCounter)
+			{
+				{
+					FReadScopeLock lock(Lock);
+					if (FString const* symbol = Symbols.Find(programCounter))
+						return *symbol;
+				}
+
+				FProgramCounterSymbolInfo symbolInfo;
+				FPlatformStackWalk::ProgramCounterToSymbolInfo(programCounter, symbolInfo);
+
+				ANSICHAR humanReadable[1024] = {};
+				FPlatformStackWalk::SymbolInfoToHumanReadableString(symbolInfo, humanReadable, UE_ARRAY_COUNT(humanReadable));
+				FString symbol = ANSI_TO_TCHAR(humanReadable);
+
+				FWriteScopeLock lock(Lock);
+				return Symbols.FindOrAdd(programCounter, MoveTemp(symbol));
+			}
+
+		private:
+			FSymbolCache()
+			{
+				FPlatformStackWalk::InitStackWalking();
+			}
+
+			TMap<uint64, FString> Symbols;
+			FRWLock Lock;
+		};
+	}
+
 	FCppStackTrace::FCppStackTrace(int32 numAdditionalStackFramesToIgnore, bool fastWalk, int32 stackFramesIgnoreDefaultOffset)
 	{
+		const int32 ignore = numAdditionalStackFramesToIgnore + stackFramesIgnoreDefaultOffset;
+		if (fastWalk)
+		{
+			// Only capture the program counters, symbolication is deferred until this trace is displayed
+			uint64 backTrace[MCRO_CPP_STACK_TRACE_MAX_DEPTH] = {};
+			const int32 depth = FPlatformStackWalk::CaptureStackBackTrace(backTrace, MCRO_CPP_STACK_TRACE_MAX_DEPTH);
+			for (int32 i = ignore; i < depth && backTrace[i] != 0; ++i)
+				ProgramCounters.Add(backTrace[i]);
+			return;
+		}
+
 		// Walk the stack and dump it to the allocated memory.
 		const SIZE_T stackTraceSize = 65535;
 		ANSICHAR* stackTrace = (ANSICHAR*)FMemory::SystemMalloc(stackTraceSize);
@@ -26,11 +82,43 @@ namespace Mcro::Error
 #endif
 		stackTrace[0] = 0;
 		FPlatformStackWalk::StackWalkAndDumpEx(
-			stackTrace, stackTraceSize, numAdditionalStackFramesToIgnore + stackFramesIgnoreDefaultOffset,
-			fastWalk
-				? FPlatformStackWalk::EStackWalkFlags::FastStackWalk
-				: FPlatformStackWalk::EStackWalkFlags::AccurateStackWalk
+			stackTrace, stackTraceSize, ignore,
+			FPlatformStackWalk::EStackWalkFlags::AccurateStackWalk
 		);
 		Message = ANSI_TO_TCHAR(stackTrace);
+		StackTrace = Message;
+		FMemory::SystemFree(stackTrace);
+	}
+
+	FString const& FCppStackTrace::GetStackTrace() const
+	{
+		FScopeLock lock(&ResolveMutex);
+		if (!StackTrace.IsSet())
+		{
+			TStringBuilder<4096> builder;
+			FSymbolCache& symbols = FSymbolCache::Get();
+			for (uint64 programCounter : ProgramCounters)
+				builder << symbols.Resolve(programCounter) << TEXT_"\n";
+			StackTrace = builder.ToString();
+			Message = StackTrace.GetValue();
+		}
+		return StackTrace.GetValue();
+	}
+
+	void FCppStackTrace::RenderDeferredText() const
+	{
+		IPlainTextComponent::RenderDeferredText();
+		GetStackTrace();
+	}
+
+	void FCppStackTrace::SerializeYaml(YAML::Emitter& emitter) const
+	{
+		using namespace Mcro::Yaml;
+		emitter << YAML::Literal << GetStackTrace();
+	}
+
+	void FCppStackTrace::SerializeFields(IErrorSerializer& serializer, bool isRoot) const
+	{
+		serializer.WriteField("Message", GetStackTrace());
 	}
 }
@@ -0,0 +1,195 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+
+#include "Mcro/Error/ErrorSerializer.h"
+
+namespace Mcro::Error
+{
+	void FJsonLinesErrorWriter::BeginError(FStringView name)
+	{
+		if (!Levels.IsEmpty())
+		{
+			EnterSection(ESection::InnerErrors);
+			WriteItemSeparator();
+			WriteString(name);
+			WriteRaw(":");
+		}
+		Levels.Emplace();
+		WriteRaw("{");
+	}
+
+	void FJsonLinesErrorWriter::WriteField(FAnsiStringView field, FStringView value)
+	{
+		EnterSection(ESection::Fields);
+		WriteItemSeparator();
+		WriteString(field);
+		WriteRaw(":");
+		WriteString(value);
+	}
+
+	void FJsonLinesErrorWriter::WritePropagation(std::source_location const& location)
+	{
+		EnterSection(ESection::Propagation);
+		WriteItemSeparator();
+
+		// Same format as in the YAML representation
+		ANSICHAR line[16];
+		const int32 lineLength = FCStringAnsi::Snprintf(line, UE_ARRAY_COUNT(line), "%u", location.line());
+		WriteRaw("\"");
+		WriteEscaped(location.function_name());
+		WriteRaw(" @ ");
+		WriteEscaped(location.file_name());
+		WriteRaw(" : ");
+		WriteRaw(FAnsiStringView(line, lineLength));
+		WriteRaw("\"");
+	}
+
+	void FJsonLinesErrorWriter::EndError()
+	{
+		check(!Levels.IsEmpty());
+		EnterSection(ESection::Fields);
+		Levels.Pop();
+		WriteRaw("}");
+		if (Levels.IsEmpty()) WriteRaw("\n");
+	}
+
+	void FJsonLinesErrorWriter::EnterSection(ESection section)
+	{
+		FLevel& level = Levels.Last();
+		if (level.Section == section) return;
+
+		switch (level.Section)
+		{
+		case ESection::Propagation: WriteRaw("]"); break;
+		case ESection::InnerErrors: WriteRaw("}"); break;
+		default: break;
+		}
+
+		level.Section = section;
+		level.bSectionEmpty = true;
+		if (section == ESection::Fields) return;
+
+		if (!level.bObjectEmpty) WriteRaw(",");
+		level.bObjectEmpty = false;
+		WriteRaw(section == ESection::Propagation ? "\"ErrorPropagation\":[" : "\"InnerErrors\":{");
+	}
+
+	void FJsonLinesErrorWriter::WriteItemSeparator()
+	{
+		FLevel& level = Levels.Last();
+		bool& empty = level.Section == ESection::Fields ? level.bObjectEmpty : level.bSectionEmpty;
+		if (!empty) WriteRaw(",");
+		empty = false;
+	}
+
+	void FJsonLinesErrorWriter::WriteRaw(FAnsiStringView text)
+	{
+		Archive.Serialize(const_cast<ANSICHAR*>(text.GetData()), text.Len());
+	}
+
+	void FJsonLinesErrorWriter::WriteEscaped(FAnsiStringView text)
+	{
+		// Characters which need escaping are all single bytes in UTF-8, so safe runs are written in bulk
+		int32 runStart = 0;
+		for (int32 i = 0; i < text.Len(); ++i)
+		{
+			const uint8 c = static_cast<uint8>(text[i]);
+			if (c >= 0x20 && c != '"' && c != '\\') continue;
+
+			WriteRaw(text.Mid(runStart, i - runStart));
+			runStart = i + 1;
+			switch (c)
+			{
+			case '"':  WriteRaw("\\\""); break;
+			case '\\': WriteRaw("\\\\"); break;
+			case '\n': WriteRaw("\\n"); break;
+			case '\r': WriteRaw("\\r"); break;
+			case '\t': WriteRaw("\\t"); break;
+			default:
+				{
+					ANSICHAR escaped[8];
+					const int32 length = FCStringAnsi::Snprintf(escaped, UE_ARRAY_COUNT(escaped), "\\u%04x", c);
+					WriteRaw(FAnsiStringView(escaped, length));
+				}
+			}
+		}
+		WriteRaw(text.Mid(runStart));
+	}
+
+	void FJsonLinesErrorWriter::WriteString(FAnsiStringView text)
+	{
+		WriteRaw("\"");
+		WriteEscaped(text);
+		WriteRaw("\"");
+	}
+
+	void FJsonLinesErrorWriter::WriteString(FStringView text)
+	{
+		const FTCHARToUTF8 utf8(text.GetData(), text.Len());
+		WriteString(FAnsiStringView(utf8.Get(), utf8.Length()));
+	}
+
+	void FBinaryErrorWriter::BeginError(FStringView name)
+	{
+		if (Depth == 0)
+		{
+			WriteTag(ETag::Header);
+			uint8 version = FormatVersion;
+			Archive << version;
+		}
+		++Depth;
+		WriteTag(ETag::BeginError);
+		WriteString(name);
+	}
+
+	void FBinaryErrorWriter::WriteField(FAnsiStringView field, FStringView value)
+	{
+		WriteTag(ETag::Field);
+		WriteString(field);
+		WriteString(value);
+	}
+
+	void FBinaryErrorWriter::WritePropagation(std::source_location const& location)
+	{
+		WriteTag(ETag::Propagation);
+		WriteString(FAnsiStringView(location.function_name()));
+		WriteString(FAnsiStringView(location.file_name()));
+		uint32 line = location.line();
+		Archive << line;
+	}
+
+	void FBinaryErrorWriter::EndError()
+	{
+		check(Depth > 0);
+		--Depth;
+		WriteTag(ETag::EndError);
+	}
+
+	void FBinaryErrorWriter::WriteTag(ETag tag)
+	{
+		uint8 value = static_cast<uint8>(tag);
+		Archive << value;
+	}
+
+	void FBinaryErrorWriter::WriteString(FAnsiStringView text)
+	{
+		uint32 length = text.Len();
+		Archive << length;
+		Archive.Serialize(const_cast<ANSICHAR*>(text.GetData()), length);
+	}
+
+	void FBinaryErrorWriter::WriteString(FStringView text)
+	{
+		const FTCHARToUTF8 utf8(text.GetData(), text.Len());
+		WriteString(FAnsiStringView(utf8.Get(), utf8.Length()));
+	}
+}
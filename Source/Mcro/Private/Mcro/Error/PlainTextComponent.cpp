@@ -19,7 +19,7 @@ namespace Mcro::Error
 	
 	void IPlainTextComponent::SerializeYaml(YAML::Emitter& emitter) const
 	{
-		emitter << YAML::Literal << Message;
+		emitter << YAML::Literal << GetMessage();
 	}
 
 	TSharedRef<SErrorDisplay> IPlainTextComponent::CreateErrorWidget()
@@ -0,0 +1,107 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#include "Mcro/Observable.h"
+
+namespace Mcro::Observable
+{
+	namespace Detail
+	{
+		static thread_local FStateBatch* GCurrentStateBatch = nullptr;
+		static thread_local int32 GStateWaveDepth = 0;
+		static thread_local TArray<IStateWaveListener*, TInlineAllocator<16>> GStateWavePending;
+
+		FStateWave::FStateWave()
+		{
+			++GStateWaveDepth;
+		}
+
+		FStateWave::~FStateWave()
+		{
+			if (GStateWaveDepth > 1)
+			{
+				--GStateWaveDepth;
+				return;
+			}
+			
+			// The wave is kept open while deferred listeners run, so the changes they cause are deferred as well
+			for (int32 i = 0; i < GStateWavePending.Num(); ++i)
+			{
+				if (IStateWaveListener* listener = GStateWavePending[i])
+					listener->OnWaveEnd();
+			}
+			GStateWavePending.Reset();
+			--GStateWaveDepth;
+		}
+
+		void FStateWave::Defer(IStateWaveListener& listener)
+		{
+			if (GStateWaveDepth > 0) GStateWavePending.Add(&listener);
+			else listener.OnWaveEnd();
+		}
+
+		void FStateWave::Forget(IStateWaveListener& listener)
+		{
+			for (IStateWaveListener*& entry : GStateWavePending)
+			{
+				if (entry == &listener) entry = nullptr;
+			}
+		}
+	}
+
+	FStateBatch::FStateBatch()
+		: Outer(Detail::GCurrentStateBatch)
+	{
+		if (!Outer) Detail::GCurrentStateBatch = this;
+	}
+
+	FStateBatch::~FStateBatch()
+	{
+		if (Outer) return;
+		Flush();
+		Detail::GCurrentStateBatch = nullptr;
+	}
+
+	FStateBatch* FStateBatch::GetCurrent()
+	{
+		return Detail::GCurrentStateBatch;
+	}
+
+	void FStateBatch::Flush()
+	{
+		if (Outer)
+		{
+			Outer->Flush();
+			return;
+		}
+		
+		// Listeners may change other states during the flush, those are appended and flushed in the same loop
+		for (int32 i = 0; i < States.Num(); ++i)
+		{
+			if (Detail::IBatchedState* state = States[i])
+				state->FlushBatch();
+		}
+		States.Reset();
+	}
+
+	void FStateBatch::Add(Detail::IBatchedState& state)
+	{
+		States.Add(&state);
+	}
+
+	void FStateBatch::Forget(Detail::IBatchedState& state)
+	{
+		for (Detail::IBatchedState*& entry : States)
+		{
+			if (entry == &state) entry = nullptr;
+		}
+	}
+}
@@ -0,0 +1,89 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#include "Mcro/Observable/ComputedState.h"
+
+namespace Mcro::Observable::Detail
+{
+	FComputedNode::~FComputedNode()
+	{
+		for (FDependency& dependency : Dependencies)
+			Unlink(dependency);
+
+		for (FComputedNode* dependent : Dependents)
+		{
+			dependent->Dependencies.RemoveAll([this](FDependency const& dependency)
+			{
+				return dependency.Node == this;
+			});
+			dependent->MarkDirty();
+		}
+	}
+
+	void FComputedNode::MarkDirty()
+	{
+		if (bDirty) return;
+		bDirty = true;
+
+		for (FComputedNode* dependent : Dependents)
+			dependent->MarkDirty();
+
+		if (HasListeners()) FStateWave::Defer(*this);
+	}
+
+	void FComputedNode::BeginTracking()
+	{
+		for (FDependency& dependency : Dependencies)
+			dependency.bSeen = false;
+	}
+
+	void FComputedNode::EndTracking()
+	{
+		for (int32 i = Dependencies.Num() - 1; i >= 0; --i)
+		{
+			if (Dependencies[i].bSeen) continue;
+			Unlink(Dependencies[i]);
+			Dependencies.RemoveAtSwap(i);
+		}
+	}
+
+	void FComputedNode::TrackNode(FComputedNode& upstream)
+	{
+		if (MarkSeen(&upstream)) return;
+
+		upstream.Dependents.Add(this);
+		AddDependency({ .Key = &upstream, .Node = &upstream });
+	}
+
+	bool FComputedNode::MarkSeen(const void* key)
+	{
+		for (FDependency& dependency : Dependencies)
+		{
+			if (dependency.Key == key)
+			{
+				dependency.bSeen = true;
+				return true;
+			}
+		}
+		return false;
+	}
+
+	void FComputedNode::AddDependency(FDependency&& dependency)
+	{
+		Dependencies.Add(MoveTemp(dependency));
+	}
+
+	void FComputedNode::Unlink(FDependency& dependency)
+	{
+		if (dependency.Node) dependency.Node->Dependents.RemoveSwap(this);
+		if (dependency.Unsubscribe) dependency.Unsubscribe();
+	}
+}
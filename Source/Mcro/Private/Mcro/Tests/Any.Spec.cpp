@@ -28,8 +28,22 @@ namespace Mcro::Test
 	struct IBaseC {};
 
 	struct FIntrusiveInherit : TInherit<IBaseA, IBaseB, IBaseC> {};
+
+	struct FAnyTestLarge { uint8 Data[MCRO_ANY_INLINE_SIZE + 1] {}; };
+
+	struct FAnyTestSelfReferencing
+	{
+		FAnyTestSelfReferencing() {}
+		FAnyTestSelfReferencing(FAnyTestSelfReferencing const&) {}
+		FAnyTestSelfReferencing(FAnyTestSelfReferencing&&) noexcept {}
+		FAnyTestSelfReferencing* Self = this;
+	};
 }
 
+/** Only contains plain integers, so it's bitwise relocatable */
+template <>
+constexpr bool Mcro::Any::TAnyInlineAllowed<FCopyConstructCounter> = true;
+
 DEFINE_SPEC(
 	FMcroAny_Spec,
 	TEXT_"Mcro.Any",
@@ -79,6 +93,34 @@ void FMcroAny_Spec::Define()
 			TestEqual(TEXT_"Contents shouldn't actually move", movedCopy.TryGet<FCopyConstructCounter>()->MoveCount, 0);
 		});
 		
+		It(TEXT_"should store small values inline", [this]
+		{
+			auto payload = FAny(TInPlaceType<FCopyConstructCounter>());
+			TestTrue(TEXT_"Small value is inline", payload.IsInline());
+			check(payload.TryGet<FCopyConstructCounter>());
+			
+			FAny copy = payload;
+			check(copy.TryGet<FCopyConstructCounter>());
+			TestTrue(TEXT_"Copy is inline", copy.IsInline());
+			TestEqual(TEXT_"Copy once", copy.TryGet<FCopyConstructCounter>()->CopyCount, 1);
+			
+			FAny movedCopy { MoveTemp(copy) };
+			check(movedCopy.TryGet<FCopyConstructCounter>());
+			TestFalse(TEXT_"Source should be invalid", copy.IsValid());
+			TestEqual(TEXT_"Inline contents are move constructed", movedCopy.TryGet<FCopyConstructCounter>()->MoveCount, 1);
+
+			auto inheriting = FAny(TInPlaceType<FIntrusiveInherit>());
+			TestTrue(TEXT_"Empty value is inline", inheriting.IsInline());
+			TestNotNull(TEXT_"Fetch inline with alias type", inheriting.TryGet<IBaseB>());
+
+			auto large = FAny(TInPlaceType<FAnyTestLarge>());
+			TestFalse(TEXT_"Large value is on the heap", large.IsInline());
+			TestNotNull(TEXT_"Fetch large value", large.TryGet<FAnyTestLarge>());
+
+			auto selfReferencing = FAny(TInPlaceType<FAnyTestSelfReferencing>());
+			TestFalse(TEXT_"Types which are not bitwise relocatable are on the heap", selfReferencing.IsInline());
+		});
+		
 		It(TEXT_"should support object lifespan customization", [this]
 		{
 			TMap<int, FAnyTest> stupidPool { {1, FAnyTest{.B = 1}} };
@@ -112,3 +154,56 @@ void FMcroAny_Spec::Define()
 		});
 	});
 }
+
+
+DEFINE_SPEC(
+	FMcroAny_Benchmark,
+	TEXT_"Mcro.Benchmark.Any",
+	EAutomationTestFlags_ApplicationContextMask
+	| EAutomationTestFlags::PerfFilter
+);
+
+void FMcroAny_Benchmark::Define()
+{
+	using namespace Mcro::Test;
+
+	Describe(TEXT_"FAny::TryGet", [this]
+	{
+		It(TEXT_"should be faster than probing a set of FType", [this]
+		{
+			constexpr int32 iterations = 1'000'000;
+			auto payload = FAny(new FIntrusiveInherit()).WithAlias<FAnyTestBase>();
+
+			// This is how FAny used to check type safety
+			TSet<FType> validTypes {
+				TTypeOf<FIntrusiveInherit>,
+				TTypeOf<IBaseA>, TTypeOf<IBaseB>, TTypeOf<IBaseC>,
+				TTypeOf<FAnyTestBase>
+			};
+			
+			int32 setHits = 0;
+			double setStart = FPlatformTime::Seconds();
+			for (int32 i = 0; i < iterations; ++i)
+			{
+				setHits += validTypes.Contains(TTypeOf<IBaseC>);
+				setHits += validTypes.Contains(TTypeOf<FVector>);
+			}
+			double setDuration = FPlatformTime::Seconds() - setStart;
+			
+			int32 anyHits = 0;
+			double anyStart = FPlatformTime::Seconds();
+			for (int32 i = 0; i < iterations; ++i)
+			{
+				anyHits += payload.TryGet<IBaseC>() != nullptr;
+				anyHits += payload.TryGet<FVector>() != nullptr;
+			}
+			double anyDuration = FPlatformTime::Seconds() - anyStart;
+
+			TestEqual(TEXT_"Same results", anyHits, setHits);
+			UE_LOG(LogTemp, Display,
+				TEXT_"TSet<FType>::Contains: %f ms | FAny::TryGet: %f ms (%d iterations)",
+				setDuration * 1000.0, anyDuration * 1000.0, iterations
+			);
+		});
+	});
+}
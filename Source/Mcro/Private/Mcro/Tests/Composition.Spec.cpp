@@ -56,6 +56,22 @@ namespace Mcro::Test
 			to.Confirmation();
 		}
 	};
+
+	struct FStaticComposableSimple;
+
+	struct FStaticParentAware : IStrictComponent
+	{
+		void OnCreatedAt(FStaticComposableSimple& to) { Parent = &to; }
+		void OnCopiedAt(FStaticComposableSimple& to, FStaticParentAware const& from) { Parent = &to; }
+		void OnMovedAt(FStaticComposableSimple& to) { Parent = &to; }
+		
+		FStaticComposableSimple* Parent = nullptr;
+	};
+
+	struct FStaticComposableSimple : TStaticComposable<
+		TTypes<FSimpleComponent, FComponentA, FAutoComponentA, FStaticParentAware>,
+		FStaticComposableSimple
+	> {};
 }
 
 DEFINE_SPEC(
@@ -103,6 +119,141 @@ void FMcroComposition_Spec::Define()
 			TestEqual(TEXT_"Support TInherit",  anotherComponents.Num(), 3);
 		});
 		
+		It(TEXT_"should query components without type erasure.", [this]
+		{
+			auto payload = FComposableSimple()
+				.With<FSimpleComponent>()
+				.With<FComponentA>().With(TTypes<FComponentBase, IComponentInterface>())
+				.With<FAutoComponentA>()
+				.With<FAutoComponentB>()
+			;
+			
+			auto exact = payload.QueryComponents<FSimpleComponent>();
+			TestEqual(TEXT_"Single exact component", exact.Num(), 1);
+			TestEqual(TEXT_"Exact component is the first", exact.First(), payload.TryGet<FSimpleComponent>());
+
+			auto aliased = payload.QueryComponents<IComponentInterface>();
+			TestEqual(TEXT_"Aliased components", aliased.Num(), 3);
+			
+			int32 count = 0;
+			for (IComponentInterface* component : aliased)
+			{
+				TestNotNull(TEXT_"Aliased component", component);
+				++count;
+			}
+			TestEqual(TEXT_"Iterated aliased components", count, 3);
+			
+			auto asArray = aliased | RenderAs<TArray>();
+			TestEqual(TEXT_"Views are composable with range-v3", asArray.Num(), 3);
+
+			TestTrue(TEXT_"Empty view for non-components", payload.QueryComponents<FVector>().IsEmpty());
+			TestNull(TEXT_"First of empty view", payload.QueryComponents<FVector>().First());
+			TestEqual(TEXT_"Dynamic query", payload.QueryComponentsDynamic(TTypeHash<IAnotherInterface>).Num(), 2);
+		});
+		
+		It(TEXT_"should preserve components and aliases when copied or moved.", [this]
+		{
+			auto payload = FComposableSimple()
+				.With<FAutoComponentC>()
+				.With<FComponentB>().With(TTypes<FComponentBase, IComponentInterface>())
+				.With<FSimpleComponent>()
+				.With<FAutoComponentA>()
+			;
+			payload.Get<FSimpleComponent>().D = 10;
+			
+			FComposableSimple copy = payload;
+			TestEqual(TEXT_"Copied value", copy.Get<FSimpleComponent>().D, 10);
+			TestNotEqual(TEXT_"Copy is a different object", &copy.Get<FSimpleComponent>(), &payload.Get<FSimpleComponent>());
+			auto copiedComponents = copy.GetComponents<IComponentInterface>() | RenderAs<TArray>();
+			TestEqual(TEXT_"Copied aliases", copiedComponents.Num(), 3);
+			auto copiedAutoComponents = copy.GetComponents<IAnotherInterface>() | RenderAs<TArray>();
+			TestEqual(TEXT_"Copied TInherit aliases", copiedAutoComponents.Num(), 2);
+			
+			FComposableSimple moved = MoveTemp(copy);
+			TestEqual(TEXT_"Moved value", moved.Get<FSimpleComponent>().D, 10);
+			auto movedComponents = moved.GetComponents<IComponentInterface>() | RenderAs<TArray>();
+			TestEqual(TEXT_"Moved aliases", movedComponents.Num(), 3);
+			TestNull(TEXT_"Moved-from is empty", copy.TryGet<FSimpleComponent>());
+		});
+
+		It(TEXT_"should keep component addresses stable when more components are added.", [this]
+		{
+			FComposableSimple payload;
+			payload.Confirmation = [] {};
+			payload.AddComponent<FSimpleComponent>();
+			FSimpleComponent* simple = &payload.Get<FSimpleComponent>();
+			simple->D = 10;
+
+			// Adding many components of different types shuffles the sorted component table
+			payload
+				.With<FAutoComponentC>()
+				.With<FComponentB>().With(TTypes<FComponentBase, IComponentInterface>())
+				.With<FComponentA>()
+				.With<FAutoComponentA>()
+				.With<FAutoComponentB>()
+				.With<FChillComponent>()
+			;
+			TestEqual(TEXT_"Same address", &payload.Get<FSimpleComponent>(), simple);
+			TestEqual(TEXT_"Value is preserved", simple->D, 10);
+
+			FComposableSimple copy = payload;
+			FSimpleComponent* copiedSimple = &copy.Get<FSimpleComponent>();
+			TestNotEqual(TEXT_"Copies store their own components", copiedSimple, simple);
+			TestEqual(TEXT_"Copied value", copiedSimple->D, 10);
+
+			FComposableSimple moved = MoveTemp(copy);
+			TestEqual(TEXT_"Moving doesn't relocate components", &moved.Get<FSimpleComponent>(), copiedSimple);
+		});
+
+		It(TEXT_"should store small components inline in their FAny.", [this]
+		{
+			auto payload = FComposableSimple()
+				.With<FSimpleComponent>()
+				.With(new FComponentA())
+			;
+			auto isInline = [](IComposable const& composable, FTypeHash typeHash)
+			{
+				return composable.QueryComponentsDynamic(typeHash).First()->IsInline();
+			};
+			TestTrue(TEXT_"Constructed in-place", isInline(payload, TTypeHash<FSimpleComponent>));
+			TestFalse(TEXT_"Adopted components stay on the heap", isInline(payload, TTypeHash<FComponentA>));
+
+			FComposableSimple copy = payload;
+			TestTrue(TEXT_"Copies are stored inline too", isInline(copy, TTypeHash<FSimpleComponent>));
+			TestEqual(TEXT_"Copied value", copy.Get<FSimpleComponent>().D, 3);
+		});
+
+		It(TEXT_"should share components of copies until they're modified in copy-on-write mode.", [this]
+		{
+			auto prototype = FComposableSimple()
+				.With<FSimpleComponent>()
+				.With<FComponentB>().With(TTypes<FComponentBase, IComponentInterface>())
+				.WithCopyOnWrite()
+			;
+			TestTrue(TEXT_"Copy-on-write enabled", prototype.IsCopyOnWrite());
+
+			FComposableSimple copy = prototype;
+			FComposableSimple const& constCopy = copy;
+			FComposableSimple const& constPrototype = prototype;
+			TestTrue(TEXT_"Copy inherits copy-on-write", copy.IsCopyOnWrite());
+			TestEqual(TEXT_"Shared while reading",
+				&constCopy.Get<FSimpleComponent>(),
+				&constPrototype.Get<FSimpleComponent>()
+			);
+
+			copy.Get<FSimpleComponent>().D = 10;
+			TestNotEqual(TEXT_"Detached when modified",
+				&constCopy.Get<FSimpleComponent>(),
+				&constPrototype.Get<FSimpleComponent>()
+			);
+			TestEqual(TEXT_"Modified copy", constCopy.Get<FSimpleComponent>().D, 10);
+			TestEqual(TEXT_"Prototype is untouched", constPrototype.Get<FSimpleComponent>().D, 3);
+
+			copy.Get<IComponentInterface>().A = 5;
+			TestEqual(TEXT_"Detached via alias", constCopy.Get<FComponentB>().A, 5);
+			TestEqual(TEXT_"Prototype alias is untouched", constPrototype.Get<FComponentB>().A, 0);
+		});
+		
 		It(TEXT_"should call OnComponentRegistered with supported components", [this]
 		{
 			namespace rv = ranges::views;
@@ -120,6 +271,98 @@ void FMcroComposition_Spec::Define()
 			;
 		});
 		
+		It(TEXT_"should resolve static components at compile time.", [this]
+		{
+			using FStatic = FStaticComposableSimple;
+			static_assert(FStatic::HasComponent<FSimpleComponent>);
+			static_assert(FStatic::HasComponent<IAnotherInterface>);
+			static_assert(!FStatic::HasComponent<FVector>);
+			static_assert(FStatic::ComponentIndex<FComponentBase> == 1);
+			static_assert(FStatic::ComponentIndex<IComponentInterface> == 1, "First matching component in declaration order");
+			
+			FStatic payload;
+			TestEqual(TEXT_"Exact component", payload.Get<FSimpleComponent>().D, 3);
+			TestEqual(TEXT_"Aliased component", payload.Get<FComponentBase>().B, 1);
+			TestEqual(TEXT_"TInherit aliased component", &payload.Get<IAnotherInterface>(), static_cast<IAnotherInterface*>(&payload.Get<FAutoComponentA>()));
+			TestNull(TEXT_"Non-component", payload.TryGet<FVector>());
+			TestEqual(TEXT_"OnCreatedAt was called", payload.Get<FStaticParentAware>().Parent, &payload);
+
+			int32 count = 0;
+			payload.ForEachComponent<IComponentInterface>([&](IComponentInterface&) { ++count; });
+			TestEqual(TEXT_"Visit all matching components", count, 2);
+
+			FStatic copy = payload;
+			TestEqual(TEXT_"OnCopiedAt was called", copy.Get<FStaticParentAware>().Parent, &copy);
+			FStatic moved = MoveTemp(copy);
+			TestEqual(TEXT_"OnMovedAt was called", moved.Get<FStaticParentAware>().Parent, &moved);
+
+			FStatic assigned;
+			assigned = payload;
+			TestEqual(TEXT_"OnCopiedAt was called on copy assignment", assigned.Get<FStaticParentAware>().Parent, &assigned);
+			FStatic moveAssigned;
+			moveAssigned = MoveTemp(assigned);
+			TestEqual(TEXT_"OnMovedAt was called on move assignment", moveAssigned.Get<FStaticParentAware>().Parent, &moveAssigned);
+		});
+
+		It(TEXT_"should query many composables by archetype.", [this]
+		{
+			TArray<TUniquePtr<FComposableSimple>> composables;
+			FComposableRegistry registry;
+			for (int32 i = 0; i < 300; ++i)
+			{
+				auto& composable = composables.Add_GetRef(MakeUnique<FComposableSimple>());
+				composable->AddComponent<FSimpleComponent>();
+				if (i % 3 == 0) composable->AddComponent<FAutoComponentA>();
+				registry.Register(*composable);
+			}
+			TestEqual(TEXT_"Registered", registry.Num(), 300);
+			TestEqual(TEXT_"Archetypes", registry.NumArchetypes(), 2);
+
+			int32 count = 0;
+			registry.ForEach<FSimpleComponent, IAnotherInterface>([&](IComposable& composable, FSimpleComponent& simple, IAnotherInterface&)
+			{
+				TestEqual(TEXT_"Matching component", &simple, static_cast<FComposableSimple&>(composable).TryGet<FSimpleComponent>());
+				++count;
+			});
+			TestEqual(TEXT_"Matching composables", count, 100);
+
+			int32 chunks = 0;
+			registry.ForEachChunk<const FSimpleComponent>([&](TComposableChunk<const FSimpleComponent> const& chunk)
+			{
+				TestTrue(TEXT_"Chunk size", chunk.Num() > 0 && chunk.Num() <= MCRO_COMPOSABLE_CHUNK_SIZE);
+				TestEqual(TEXT_"Columns", chunk.Get<0>().Num(), chunk.Num());
+				++chunks;
+			});
+			TestTrue(TEXT_"Chunked iteration", chunks >= 300 / MCRO_COMPOSABLE_CHUNK_SIZE);
+
+			std::atomic<int32> sum = 0;
+			registry.ParallelForEach<FSimpleComponent>([&](IComposable&, FSimpleComponent& simple)
+			{
+				sum += simple.D;
+			});
+			TestEqual(TEXT_"Parallel iteration", sum.load(), 300 * 3);
+
+			composables[1]->AddComponent<FAutoComponentB>();
+			count = 0;
+			registry.ForEach<IAnotherInterface>([&](IComposable&, IAnotherInterface&) { ++count; });
+			TestEqual(TEXT_"Updated when components are added", count, 101);
+
+			composables.RemoveAt(0);
+			TestEqual(TEXT_"Unregistered when destroyed", registry.Num(), 299);
+
+			auto moved = MakeUnique<FComposableSimple>(MoveTemp(*composables[0]));
+			TestTrue(TEXT_"Registration is handed over when moved", registry.IsRegistered(*moved));
+			TestFalse(TEXT_"Moved-from composable is not registered", registry.IsRegistered(*composables[0]));
+			TestEqual(TEXT_"Moving doesn't change the registered count", registry.Num(), 299);
+
+			bool bVisitedMoved = false;
+			registry.ForEach<FSimpleComponent>([&](IComposable& composable, FSimpleComponent&)
+			{
+				bVisitedMoved |= &composable == moved.Get();
+			});
+			TestTrue(TEXT_"Moved composable is still queried", bVisitedMoved);
+		});
+		
 		It(TEXT_"should respect shared objects.", [this]
 		{
 			auto payload = MakeShared<FSharedComposable>()
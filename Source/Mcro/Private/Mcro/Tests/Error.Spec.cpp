@@ -12,6 +12,7 @@
 #include "CoreMinimal.h"
 #include "Misc/AutomationTest.h"
 #include "Algo/Count.h"
+#include "Serialization/MemoryWriter.h"
 #include "Mcro/Common.h"
 #include "Mcro/Tests/TestCompatibility.h"
 
@@ -117,6 +118,132 @@ void FMcroError_Spec::Define()
 			TestEqual(TEXT_"Error Code context", error->GetCodeContext(), STRING_"D = A + B + C");
 			ERROR_LOG(LogTemp, Display, error);
 		});
+
+		It(TEXT_"should symbolicate C++ stack traces only when they're read", [this]
+		{
+			auto stackTrace = IError::Make(new FCppStackTrace(0, true));
+			TestFalse(TEXT_"Program counters are captured", stackTrace->GetProgramCounters().IsEmpty());
+			TestFalse(TEXT_"Reading the message resolves the stack trace", stackTrace->GetMessage().IsEmpty());
+			TestEqual(TEXT_"Message is the stack trace", stackTrace->GetMessage(), stackTrace->GetStackTrace());
+
+			auto sameSite = IError::Make(new FCppStackTrace(0, true));
+			TestFalse(TEXT_"Serialized error contains the stack trace", sameSite->ToString().IsEmpty());
+		});
+
+		It(TEXT_"should format texts given as literals only when they're read", [this]
+		{
+			FString dynamicFormat = TEXT_"Dynamic {0}";
+			auto error = IError::Make(new FTestSimpleError())
+				->WithMessageF(TEXT_"Message {0}", 1)
+				->WithDetailsF(*dynamicFormat, 2)
+				->WithAppendixF(TEXT_"Numbers", TEXT_"Appendix {0} {1}", 3, 4);
+			dynamicFormat.Reset();
+
+			TestEqual(TEXT_"Deferred message", error->GetMessage(), STRING_"Message 1");
+			TestEqual(TEXT_"Immediate details", error->GetDetails(), STRING_"Dynamic 2");
+			TestTrue(TEXT_"Deferred appendix", error->ToString().Contains(TEXT_"Appendix 3 4"));
+
+			error->WithMessage(TEXT_"Overridden");
+			TestEqual(TEXT_"Plain message overrides deferred one", error->GetMessage(), STRING_"Overridden");
+
+			error->WithMessageF(TEXT_"Message {0}", 5);
+			TestEqual(TEXT_"Deferred message is rendered again after it's set on a rendered error", error->GetMessage(), STRING_"Message 5");
+		});
+
+		It(TEXT_"should stream error trees to archives", [this]
+		{
+			auto error = IError::Make(new FTestSimpleError())
+				->WithMessage(TEXT_"Quoted \"message\"\nwith lines")
+				->WithLocation()
+				->WithError(TEXT_"Inner", IError::Make(new FAssertion())->WithDetails(TEXT_"Details"))
+				->AsRecoverable();
+
+			TArray<uint8> jsonBytes;
+			FMemoryWriter jsonArchive(jsonBytes);
+			FJsonLinesErrorWriter jsonWriter(jsonArchive);
+			error->Serialize(jsonWriter);
+			error->Serialize(jsonWriter);
+
+			jsonBytes.Add(0);
+			const FString json = UTF8_TO_TCHAR(reinterpret_cast<const ANSICHAR*>(jsonBytes.GetData()));
+			TArray<FString> lines;
+			json.ParseIntoArrayLines(lines);
+			TestEqual(TEXT_"One line per root error", lines.Num(), 2);
+			TestTrue(TEXT_"Strings are escaped", json.Contains(TEXT_"\"Message\":\"Quoted \\\"message\\\"\\nwith lines\""));
+			TestTrue(TEXT_"Propagation is written", json.Contains(TEXT_"\"ErrorPropagation\":[\""));
+			TestTrue(TEXT_"Inner errors are nested", json.Contains(TEXT_"\"InnerErrors\":{\"Mcro::Error::FAssertion Inner\":{\"Details\":\"Details\"}}"));
+
+			TArray<uint8> binaryBytes;
+			FMemoryWriter binaryArchive(binaryBytes);
+			FBinaryErrorWriter binaryWriter(binaryArchive);
+			error->Serialize(binaryWriter);
+			TestEqual(TEXT_"Binary format starts with a header", binaryBytes[0], static_cast<uint8>(FBinaryErrorWriter::ETag::Header));
+			TestEqual(TEXT_"Binary format ends with the root error", binaryBytes.Last(), static_cast<uint8>(FBinaryErrorWriter::ETag::EndError));
+		});
+
+		It(TEXT_"should throttle repeated assertion failures at the same call-site", [this]
+		{
+			using namespace Mcro::AssertMacros::Detail;
+			FAssertSite site;
+			TestTrue(TEXT_"First failure is submitted", site.ShouldSubmit(EErrorSeverity::Recoverable));
+			TestEqual(TEXT_"Nothing is suppressed before the first report", site.ConsumeSuppressed(), 0);
+
+			int32 submitted = 0;
+			for (int32 i = 0; i < 10; ++i)
+				if (site.ShouldSubmit(EErrorSeverity::Recoverable)) ++submitted;
+
+			TestEqual(TEXT_"Repeated failures are throttled", submitted, 0);
+			TestTrue(TEXT_"Crashing failures are never throttled", site.ShouldSubmit(EErrorSeverity::Crashing));
+			TestTrue(TEXT_"Fatal failures are not throttled while they end the session", site.ShouldSubmit(EErrorSeverity::Fatal));
+			TestFalse(TEXT_"Suppressed failures are not flushed before the interval", site.FlushSuppressed(FPlatformTime::Seconds() - 1.0));
+			IErrorPtr aggregate;
+			TestTrue(TEXT_"Suppressed failures are flushed after the interval", site.FlushSuppressed(FPlatformTime::Seconds() + MCRO_ASSERT_MAX_REPORT_INTERVAL, &aggregate));
+			TestTrue(TEXT_"Flushed failures are reported as a single error", aggregate.IsValid() && aggregate->GetSeverity() == EErrorSeverity::Recoverable);
+			TestEqual(TEXT_"Flushed failures are consumed", site.ConsumeSuppressed(), 0);
+			TestEqual(TEXT_"Total failures are counted", site.GetTotalFailures(), 13ull);
+		});
+	});
+
+	Describe(TEXT_"TMaybe", [this]
+	{
+		It(TEXT_"should store either a value or an error", [this]
+		{
+			static_assert(sizeof(FCanFail) == sizeof(IErrorPtr), "FCanFail should be only an error pointer");
+
+			FCanFail failed = IError::Make(new FAssertion())->WithLocation();
+			TestTrue(TEXT_"Errors are not mistaken for FVoid values", failed.HasError());
+			TestTrue(TEXT_"Success has no error", Success().HasValue());
+
+			TMaybe<FString> value = STRING_"Foo";
+			TestEqual(TEXT_"Value is stored", *value.TryGetValue(), STRING_"Foo");
+
+			TMaybe<FString> error = IError::Make(new FUnavailable());
+			TestNull(TEXT_"Error has no value", error.TryGetValue());
+			TMaybe<FString> copied = error;
+			TestTrue(TEXT_"Errors are copied", copied.HasError());
+
+			IErrorPtr errorPtr = IError::Make(new FUnavailable());
+			TMaybe<FString> fromPointer = errorPtr;
+			TestTrue(TEXT_"Error pointers are errors", fromPointer.HasError());
+			FCanFail fromPointerVoid = errorPtr;
+			TestTrue(TEXT_"Error pointers are not mistaken for FVoid values", fromPointerVoid.HasError());
+			FCanFail fromNull = IErrorPtr();
+			TestTrue(TEXT_"Null error pointers are still errors", fromNull.HasError());
+		});
+
+		It(TEXT_"should chain fallible operations", [this]
+		{
+			auto length = TMaybe<FString>(STRING_"Hello")
+				.Map([](FString&& text) { return text.Len(); })
+				.AndThen([](int32 len) -> TMaybe<int32> { return len * 2; });
+			TestEqual(TEXT_"Values are passed along", length.GetValue(), 10);
+
+			bool called = false;
+			TMaybe<int32> failed = TMaybe<FString>(IError::Make(new FUnavailable()))
+				.Map([&](FString&& text) { called = true; return text.Len(); });
+			TestTrue(TEXT_"Errors are propagated", failed.HasError());
+			TestFalse(TEXT_"Functions are not called on error", called);
+		});
 	});
 }
 
@@ -134,5 +134,295 @@ void FMcroEventDelegate_Spec::Define()
 #endif
 			}), {.Belated = true});
 		});
+
+		It(TEXT_"should give the current arguments to belated bindings added while they're moved into the cache", [this]
+		{
+			TRetainingEventDelegate<void(FString const&)> event;
+			event.Broadcast(TEXT_"first");
+
+			FString belatedValue;
+			const FDelegateHandle adder = event.Add(From([&](FString const&)
+			{
+				event.Add(From([&](FString const& value) { belatedValue = value; }), {.Once = true, .Belated = true});
+			}));
+			event.Broadcast(FString(TEXT_"second"));
+			TestEqual(TEXT_"Belated binding got the arguments of the running broadcast", belatedValue, TEXT_"second");
+			event.Remove(adder);
+		});
+
+		It(TEXT_"should not store arguments when they're not needed", [this]
+		{
+			TEventDelegate<void(FCopyConstructCounter const&), {.NoArgumentCache = true}> uncachedEvent;
+			uncachedEvent.Add(From([this](FCopyConstructCounter const& payload)
+			{
+				TestEqual(TEXT_"Listeners get the original argument", payload.CopyCount, 0);
+			}));
+			FCopyConstructCounter payload;
+			uncachedEvent.Broadcast(payload);
+			TestEqual(TEXT_"No copy is made without cache", payload.CopyCount, 0);
+
+			TRetainingEventDelegate<void(FCopyConstructCounter const&)> retainingEvent;
+			retainingEvent.Broadcast(FCopyConstructCounter());
+			retainingEvent.Add(From([this](FCopyConstructCounter const& cached)
+			{
+				TestEqual(TEXT_"R-value arguments are moved into the cache", cached.CopyCount, 0);
+				TestEqual(TEXT_"R-value arguments are moved only once", cached.MoveCount, 1);
+			}), {.Belated = true});
+		});
+
+		It(TEXT_"should not block listener changes while broadcasting with LockFreeBroadcast", [this]
+		{
+			TLockFreeEventDelegate<void(int32)> event;
+			FEvent* entered = FPlatformProcess::GetSynchEventFromPool(true);
+			FEvent* release = FPlatformProcess::GetSynchEventFromPool(true);
+			std::atomic<int32> calls = 0;
+
+			event.Add(From([&](int32)
+			{
+				entered->Trigger();
+				release->Wait();
+				++calls;
+			}));
+
+			auto broadcaster = Async(EAsyncExecution::Thread, [&] { event.Broadcast(1); });
+			entered->Wait();
+
+			// The broadcaster is blocked inside a listener at this point
+			event.Add(From([&](int32) { ++calls; }), {.Once = true});
+			const FDelegateHandle removed = event.Add(From([&](int32) { ++calls; }));
+			TestTrue(TEXT_"Listeners can be removed during a broadcast", event.Remove(removed));
+
+			release->Trigger();
+			broadcaster.Wait();
+			TestEqual(TEXT_"Listeners added during a broadcast are not called by it", calls.load(), 1);
+
+			event.Broadcast(2);
+			event.Broadcast(3);
+			TestEqual(TEXT_"Once listeners are called once", calls.load(), 4);
+
+			FPlatformProcess::ReturnSynchEventToPool(entered);
+			FPlatformProcess::ReturnSynchEventToPool(release);
+		});
+
+		It(TEXT_"should not hold locks while calling belated listeners with LockFreeBroadcast", [this]
+		{
+			TLockFreeEventDelegate<void(int32)> event;
+			event.Broadcast(1);
+			TestTrue(TEXT_"Broadcasted", event.IsBroadcasted());
+
+			int32 belatedValue = 0;
+			bool otherThreadAdded = false;
+			event.Add(From([&](int32 value)
+			{
+				belatedValue = value;
+				
+				// This would deadlock if the belated listener was called while the event is locked
+				Async(EAsyncExecution::Thread, [&]
+				{
+					event.Add(From([](int32) {}));
+					event.Broadcast(2);
+					otherThreadAdded = true;
+				}).Wait();
+			}), {.Once = true, .Belated = true});
+			
+			TestEqual(TEXT_"Belated listener got the cached arguments", belatedValue, 1);
+			TestTrue(TEXT_"Other threads are not blocked by belated listeners", otherThreadAdded);
+		});
+
+		It(TEXT_"should keep listener changes during broadcast consistent with InlineListeners", [this]
+		{
+			TEventDelegate<void(int32), {.InlineListeners = 2}> event;
+			int32 calls = 0;
+			FDelegateHandle removedHandle;
+
+			event.Add(From([&](int32)
+			{
+				++calls;
+				event.Remove(removedHandle);
+				event.Add(From([&](int32) { ++calls; }));
+			}), {.Once = true});
+			removedHandle = event.Add(From([&](int32) { ++calls; }));
+			event.Add(From([&](int32 value)
+			{
+				++calls;
+				// Nested broadcasts shouldn't execute the Once listener again
+				if (value == 1) event.Broadcast(2);
+			}));
+
+			event.Broadcast(1);
+			// The third one, then the third, the second and the Once listener (removing the second) in the nested
+			// broadcast. The outer broadcast doesn't call the removed second or the fired Once listener anymore.
+			TestEqual(TEXT_"Removed listeners are not called, added ones only by later broadcasts", calls, 4);
+
+			calls = 0;
+			event.Broadcast(3);
+			TestEqual(TEXT_"Once listeners are removed, added listeners are called", calls, 2);
+			TestTrue(TEXT_"Event is still bound", event.IsBound());
+
+			event.Reset();
+			TestFalse(TEXT_"Reset removes inline listeners", event.IsBound());
+		});
+
+		It(TEXT_"should call InlineListeners in the same order as TMulticastDelegate", [this]
+		{
+			TEventDelegate<void(TArray<int32>&)> multicastEvent;
+			TEventDelegate<void(TArray<int32>&), {.InlineListeners = 2}> inlineEvent;
+			for (int32 i = 0; i < 3; ++i)
+			{
+				multicastEvent.Add(From([i](TArray<int32>& order) { order.Add(i); }));
+				inlineEvent.Add(From([i](TArray<int32>& order) { order.Add(i); }));
+			}
+
+			TArray<int32> multicastOrder;
+			TArray<int32> inlineOrder;
+			multicastEvent.Broadcast(multicastOrder);
+			inlineEvent.Broadcast(inlineOrder);
+			TestEqual(TEXT_"Same order", inlineOrder, multicastOrder);
+		});
+
+		It(TEXT_"should join every listener with BroadcastParallel", [this]
+		{
+			TLockFreeEventDelegate<void(TArray<int32> const&)> event;
+			std::atomic<int32> sum = 0;
+			std::atomic<int32> onceCalls = 0;
+
+			for (int32 i = 0; i < 16; ++i)
+			{
+				event.Add(From([&](TArray<int32> const& values)
+				{
+					for (int32 value : values) sum += value;
+				}));
+			}
+			event.Add(From([&](TArray<int32> const&) { ++onceCalls; }), {.Once = true});
+
+			const TArray<int32> values { 1, 2, 3 };
+			event.BroadcastParallel(values);
+			TestEqual(TEXT_"All listeners finished before returning", sum.load(), 16 * 6);
+
+			event.BroadcastParallel(values);
+			TestEqual(TEXT_"Once listeners are removed after a parallel broadcast", onceCalls.load(), 1);
+			TestEqual(TEXT_"Other listeners are kept", sum.load(), 2 * 16 * 6);
+		});
+	});
+
+	Describe(TEXT_"TQueuedEventDelegate", [this]
+	{
+		It(TEXT_"should deliver broadcasts from other threads in bulk on the target thread", [this]
+		{
+			TQueuedEventDelegate<void(int32)> event {{ .Thread = ENamedThreads::GameThread, .CoalesceIdentical = true }};
+			TArray<int32> received;
+			bool onlyOnGameThread = true;
+			event.Add(From([&](int32 value)
+			{
+				onlyOnGameThread &= IsInGameThread();
+				received.Add(value);
+			}));
+
+			int32 onceCalls = 0;
+			event.Add(From([&](int32) { ++onceCalls; }), {.Once = true});
+
+			Async(EAsyncExecution::Thread, [&]
+			{
+				for (int32 i = 0; i < 1000; ++i)
+					event.Broadcast(i % 10);
+			}).Wait();
+
+			TestTrue(TEXT_"Nothing is delivered before the target thread runs its tasks", received.IsEmpty());
+			FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+
+			TestTrue(TEXT_"Listeners are called on the target thread", onlyOnGameThread);
+			TestEqual(TEXT_"Identical payloads are coalesced", received.Num(), 10);
+			TestEqual(TEXT_"In order of their first broadcast", received[3], 3);
+			TestEqual(TEXT_"Once listeners are called once", onceCalls, 1);
+		});
+
+		It(TEXT_"should keep delivery order when listeners broadcast during a flush", [this]
+		{
+			TQueuedEventDelegate<void(int32)> event {{ .Thread = ENamedThreads::GameThread }};
+			TArray<int32> received;
+			event.Add(From([&](int32 value)
+			{
+				received.Add(value);
+				if (value == 1) event.Broadcast(10);
+			}));
+
+			Async(EAsyncExecution::Thread, [&]
+			{
+				event.Broadcast(1);
+				event.Broadcast(2);
+			}).Wait();
+			FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+
+			TestEqual(TEXT_"Broadcasts from listeners are delivered after the pending ones", received, TArray<int32> {1, 2, 10});
+		});
+	});
+}
+
+DEFINE_SPEC(
+	FMcroEventDelegate_Benchmark,
+	TEXT_"Mcro.Benchmark.EventDelegate",
+	EAutomationTestFlags_ApplicationContextMask
+	| EAutomationTestFlags::PerfFilter
+);
+
+namespace Mcro::Test
+{
+	template <typename Event>
+	double MeasureContendedBroadcast(int32 threads, int32 iterations, std::atomic<int64>& calls)
+	{
+		Event event;
+		event.Add(From([&calls](int32 value) { calls += value; }));
+
+		const double start = FPlatformTime::Seconds();
+		TArray<TFuture<void>> broadcasters;
+		for (int32 t = 0; t < threads; ++t)
+		{
+			broadcasters.Add(Async(EAsyncExecution::Thread, [&event, iterations]
+			{
+				for (int32 i = 0; i < iterations; ++i)
+					event.Broadcast(1);
+			}));
+		}
+		for (TFuture<void>& broadcaster : broadcasters)
+			broadcaster.Wait();
+
+		return FPlatformTime::Seconds() - start;
+	}
+}
+
+void FMcroEventDelegate_Benchmark::Define()
+{
+	using namespace Mcro::Test;
+
+	Describe(TEXT_"TEventDelegate::Broadcast", [this]
+	{
+		It(TEXT_"should scale with LockFreeBroadcast under contention", [this]
+		{
+			constexpr int32 threads = 8;
+			constexpr int32 iterations = 100'000;
+
+			std::atomic<int64> lockedCalls = 0;
+			const double locked = MeasureContendedBroadcast<TEventDelegate<void(int32), {.ThreadSafe = true}>>(
+				threads, iterations, lockedCalls
+			);
+
+			// Filling the argument cache still takes the event mutex on each broadcast
+			std::atomic<int64> lockFreeCalls = 0;
+			const double lockFree = MeasureContendedBroadcast<TLockFreeEventDelegate<void(int32)>>(
+				threads, iterations, lockFreeCalls
+			);
+
+			std::atomic<int64> uncachedCalls = 0;
+			const double uncached = MeasureContendedBroadcast<TEventDelegate<void(int32), {.LockFreeBroadcast = true, .NoArgumentCache = true}>>(
+				threads, iterations, uncachedCalls
+			);
+
+			TestEqual(TEXT_"Same number of calls", lockFreeCalls.load(), lockedCalls.load());
+			TestEqual(TEXT_"Same number of calls without argument cache", uncachedCalls.load(), lockedCalls.load());
+			UE_LOG(LogTemp, Display,
+				TEXT_"ThreadSafe: %f ms | LockFreeBroadcast: %f ms | LockFreeBroadcast + NoArgumentCache: %f ms (%d threads, %d broadcasts each)",
+				locked * 1000.0, lockFree * 1000.0, uncached * 1000.0, threads, iterations
+			);
+		});
 	});
 }
@@ -38,7 +38,7 @@ void FMcroObservable_Spec::Define()
 
 			auto [value, dummyLock] = state.GetOnAnyThread();
 
-			TestTrue(TEXT_"Lock is dummy type when thread safety is not enabled", dummyLock->IsType<FVoid>());
+			TestFalse(TEXT_"Lock is empty when thread safety is not enabled", dummyLock.IsLocked());
 			
 			TestEqual(TEXT_"Initial value", state.Get(), -2);
 			TestTrue(TEXT_"Reactive change", state.HasChangedFrom(1));
@@ -63,5 +63,280 @@ void FMcroObservable_Spec::Define()
 			TestEqual(TEXT_"Next value", nextCache, 2);
 			TestEqual(TEXT_"Previous value", previousCache, 1);
 		});
+
+		It(TEXT_"should lock thread-safe states without allocations", [this]
+		{
+			TStateTS<int> state(1);
+			{
+				auto [value, lock] = state.GetOnAnyThread();
+				TestTrue(TEXT_"Read lock is held", lock.IsLocked());
+				TestEqual(TEXT_"Locked value", value, 1);
+
+				FStateReadLock moved = MoveTemp(lock);
+				TestFalse(TEXT_"Moved-from lock is empty", lock.IsLocked());
+				TestTrue(TEXT_"Moved lock is held", moved.IsLocked());
+			}
+			{
+				FStateWriteLock lock = state.WriteLock();
+				TestTrue(TEXT_"Write lock is held", lock.IsLocked());
+				lock.Release();
+				TestFalse(TEXT_"Released lock is empty", lock.IsLocked());
+			}
+			state = 2;
+			TestEqual(TEXT_"Set after locks were released", state.Get(), 2);
+		});
+
+		It(TEXT_"should read consistent snapshots without locking", [this]
+		{
+			TStateLockFree<FVector> state(FVector::ZeroVector);
+			
+			int32 changes = 0;
+			state.OnChange([&](FVector const&) { ++changes; });
+
+			std::atomic<bool> done = false;
+			auto writer = Async(EAsyncExecution::Thread, [&]
+			{
+				for (int32 i = 1; i <= 10000; ++i)
+					state = FVector(i, i, i);
+				done = true;
+			});
+
+			bool consistent = true;
+			while (!done)
+			{
+				const FVector snapshot = state.GetSnapshot();
+				consistent &= snapshot.X == snapshot.Y && snapshot.Y == snapshot.Z;
+			}
+			writer.Wait();
+			
+			TestTrue(TEXT_"Snapshots are never torn", consistent);
+			TestEqual(TEXT_"Final snapshot", state.GetSnapshot(), FVector(10000, 10000, 10000));
+			TestEqual(TEXT_"Writers still broadcast", changes, 10000);
+
+			TState<int> regularState(3);
+			TestEqual(TEXT_"Snapshot of regular states", regularState.GetSnapshot(), 3);
+		});
+
+		It(TEXT_"should collapse notifications in batches", [this]
+		{
+			TState<int> width(0);
+			TState<int> height(0);
+			TState<int> area(0);
+			
+			int32 widthChanges = 0, heightChanges = 0, areaChanges = 0;
+			int32 lastWidth = 0, previousWidth = -1;
+			width.OnChange([&](int next, TOptional<int> const& previous)
+			{
+				++widthChanges;
+				lastWidth = next;
+				previousWidth = previous.Get(-1);
+				area = width.Get() * height.Get();
+			});
+			height.OnChange([&](int) { ++heightChanges; area = width.Get() * height.Get(); });
+			area.OnChange([&](int) { ++areaChanges; });
+			{
+				FStateBatch batch;
+				width = 10;
+				height = 20;
+				{
+					FStateBatch nested;
+					width = 30;
+				}
+				TestEqual(TEXT_"Values are stored immediately", width.Get(), 30);
+				TestEqual(TEXT_"Notifications are deferred", widthChanges, 0);
+			}
+			TestEqual(TEXT_"Width notified once", widthChanges, 1);
+			TestEqual(TEXT_"Height notified once", heightChanges, 1);
+			TestEqual(TEXT_"Changes made by listeners are collapsed too", areaChanges, 1);
+			TestEqual(TEXT_"Final value", lastWidth, 30);
+			TestEqual(TEXT_"Previous value is from before the batch", previousWidth, 0);
+			TestEqual(TEXT_"Derived value", area.Get(), 600);
+			{
+				FStateBatch batch;
+				width = 40;
+				width = 30;
+			}
+			TestEqual(TEXT_"Reverted changes are not notified", widthChanges, 1);
+
+			const uint64 versionBefore = height.GetVersion();
+			{
+				FStateBatch batch;
+				height = 1;
+				height = 2;
+				height = 3;
+			}
+			TestEqual(TEXT_"Only the final value of a batch is committed", height.GetVersion(), versionBefore + 1);
+
+			TStateTS<int> threadSafe(0);
+			int32 threadSafeChanges = 0;
+			threadSafe.OnChange([&](int) { ++threadSafeChanges; });
+			{
+				FStateBatch batch;
+				threadSafe = 1;
+				TestEqual(TEXT_"Thread-safe states are not batched", threadSafeChanges, 1);
+			}
+		});
+
+		It(TEXT_"should compute states lazily, once per change", [this]
+		{
+			TState<int> source(1);
+			int32 leftComputes = 0, rightComputes = 0, sumComputes = 0;
+			
+			TComputedState<int> left([&](FComputeContext& use) { ++leftComputes; return use(source) + 1; });
+			TComputedState<int> right([&](FComputeContext& use) { ++rightComputes; return use(source) * 10; });
+			TComputedState<int> sum([&](FComputeContext& use) { ++sumComputes; return use(left) + use(right); });
+
+			TestEqual(TEXT_"Nothing is computed until read", sumComputes, 0);
+			TestEqual(TEXT_"Initial value", sum.Get(), 12);
+			TestEqual(TEXT_"Cached value", sum.Get(), 12);
+			TestEqual(TEXT_"Computed once", sumComputes, 1);
+
+			const uint64 sumVersion = sum.GetVersion();
+			source = 2;
+			source = 3;
+			TestEqual(TEXT_"Not recomputed until read", sumComputes, 1);
+			TestEqual(TEXT_"Reading the version doesn't recompute", sum.GetVersion(), sumVersion);
+			TestEqual(TEXT_"Still not recomputed", sumComputes, 1);
+			TestEqual(TEXT_"Updated value", sum.Get(), 34);
+			TestEqual(TEXT_"Diamond is recomputed once", sumComputes, 2);
+			TestEqual(TEXT_"Version advances when recomputed", sum.GetVersion(), sumVersion + 1);
+			TestEqual(TEXT_"Left is recomputed once", leftComputes, 2);
+			TestEqual(TEXT_"Right is recomputed once", rightComputes, 2);
+
+			int32 notifications = 0, lastSum = 0;
+			sum.OnChange([&](int next) { ++notifications; lastSum = next; });
+			source = 4;
+			TestEqual(TEXT_"Listeners are notified once per wave", notifications, 1);
+			TestEqual(TEXT_"Listeners get the new value", lastSum, 45);
+			TestEqual(TEXT_"Diamond is recomputed once with listeners", sumComputes, 3);
+		});
+
+		It(TEXT_"should end propagation waves after thread-safe states are unlocked", [this]
+		{
+			TStateTS<int> source(1);
+			TComputedState<int> doubled([&](FComputeContext& use) { return use(source) * 2; });
+
+			// Deferred listeners run at the end of the wave, and they may subscribe to the state which started it
+			FDelegateHandle lateHandle;
+			doubled.OnChange([&](int)
+			{
+				if (!lateHandle.IsValid()) lateHandle = source.OnChange([](int) {});
+			});
+			source = 2;
+			TestTrue(TEXT_"Subscribed to the source at the end of the wave", lateHandle.IsValid());
+			TestEqual(TEXT_"Recomputed", doubled.Get(), 4);
+		});
+
+		It(TEXT_"should track versions without storing previous values", [this]
+		{
+			TState<FString> state(TEXT_"initial");
+			TestFalse(TEXT_"Class types don't store previous values by default", state.PolicyFlags.StorePrevious);
+
+			uint64 lastSeen = state.GetVersion();
+			TestFalse(TEXT_"Nothing changed yet", state.ConsumeChange(lastSeen));
+
+			state = TEXT_"initial";
+			TestFalse(TEXT_"Setting the same value is not a change", state.HasChangedSince(lastSeen));
+
+			state = TEXT_"next";
+			state.Modify([](FString& value) { value += TEXT_"!"; });
+			TestEqual(TEXT_"Each change increments the version", state.GetVersion(), lastSeen + 2);
+			TestTrue(TEXT_"Change is consumed", state.ConsumeChange(lastSeen));
+			TestFalse(TEXT_"Change is consumed only once", state.ConsumeChange(lastSeen));
+			TestFalse(TEXT_"No previous value was stored", state.GetPrevious().IsSet());
+		});
+
+		It(TEXT_"should keep a bounded history of values", [this]
+		{
+			TStateWithHistory<int, 3> state(1);
+			TestEqual(TEXT_"Initial value is in history", state.GetHistory().Num(), 1);
+
+			state = 2;
+			state = 3;
+			state = 4;
+			auto history = state.GetHistory();
+			TestEqual(TEXT_"History is bounded", history.Num(), 3);
+			TestEqual(TEXT_"Current value first", history[0], 4);
+			TestEqual(TEXT_"Oldest value last", history.Oldest(), 2);
+
+			int sum = 0;
+			for (int value : state.GetHistory()) sum += value;
+			TestEqual(TEXT_"History is iterable", sum, 9);
+			TestTrue(TEXT_"History works with ranges", (state.GetHistory() | RenderAs<TArray>()) == TArray { 4, 3, 2 });
+		});
+
+		It(TEXT_"should coalesce changes delivered to another thread", [this]
+		{
+			TStateTS<int> state(0);
+			int32 deliveries = 0, lastValue = 0;
+			state.OnChangeInThread(ENamedThreads::GameThread, [&](int next)
+			{
+				++deliveries;
+				lastValue = next;
+			});
+
+			Async(EAsyncExecution::Thread, [&]
+			{
+				for (int32 i = 1; i <= 500; ++i)
+					state = i;
+			}).Wait();
+
+			TestEqual(TEXT_"Nothing is delivered before the target thread runs its tasks", deliveries, 0);
+			FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+			TestEqual(TEXT_"Changes are delivered once", deliveries, 1);
+			TestEqual(TEXT_"With the latest value", lastValue, 500);
+
+			state = 501;
+			TestEqual(TEXT_"Changes on the target thread are delivered immediately", deliveries, 2);
+
+			Async(EAsyncExecution::Thread, [&] { state = 502; }).Wait();
+			state = 503;
+			FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+			TestEqual(TEXT_"Values superseded on the target thread are not delivered", deliveries, 3);
+			TestEqual(TEXT_"Latest value is kept", lastValue, 503);
+		});
+
+		It(TEXT_"should notify individual changes of collections", [this]
+		{
+			TArrayState<int> numbers;
+			TArray<FArrayStateChange> changes;
+			int32 snapshots = 0;
+			numbers.OnDelta([&](TArray<int> const&, FArrayStateChange const& change) { changes.Add(change); });
+			numbers.OnChange([&](TArray<int> const&) { ++snapshots; });
+
+			numbers.Add(1);
+			numbers.Append({ 2, 3, 4 });
+			numbers.RemoveAt(1);
+			numbers.Update(0, 10);
+			numbers.Move(0, 2);
+
+			TestTrue(TEXT_"Final array", numbers.Get() == TArray { 3, 4, 10 });
+			TestEqual(TEXT_"One change per operation", changes.Num(), 5);
+			TestTrue(TEXT_"Ranges are inserted as one change",
+				changes[1].Kind == EArrayStateChange::Insert && changes[1].Index == 1 && changes[1].Count == 3
+			);
+			TestTrue(TEXT_"Removal", changes[2].Kind == EArrayStateChange::Remove && changes[2].Index == 1);
+			TestTrue(TEXT_"Update", changes[3].Kind == EArrayStateChange::Update && changes[3].Index == 0);
+			TestTrue(TEXT_"Move", changes[4].Kind == EArrayStateChange::Move && changes[4].To == 2);
+			TestEqual(TEXT_"Snapshot listeners are still notified", snapshots, 5);
+
+			TMapState<FString, int> map;
+			TArray<TPair<EMapStateChange, FString>> mapChanges;
+			map.OnDelta([&](TMap<FString, int> const&, TMapStateChange<FString> const& change)
+			{
+				mapChanges.Add({ change.Kind, change.Key ? *change.Key : FString() });
+			});
+			map.Add(TEXT_"a", 1);
+			map.Add(TEXT_"a", 2);
+			map.Remove(TEXT_"a");
+			map.Set({});
+
+			TestEqual(TEXT_"Map changes", mapChanges.Num(), 4);
+			TestTrue(TEXT_"Add then update",
+				mapChanges[0].Key == EMapStateChange::Add && mapChanges[1].Key == EMapStateChange::Update
+			);
+			TestTrue(TEXT_"Removed key", mapChanges[2].Key == EMapStateChange::Remove && mapChanges[2].Value == TEXT_"a");
+			TestTrue(TEXT_"Set is a reset", mapChanges[3].Key == EMapStateChange::Reset);
+		});
 	});
 }
\ No newline at end of file
@@ -20,6 +20,20 @@
 #include "Mcro/FunctionTraits.h"
 #include "Mcro/TypeInfo.h"
 
+/**
+ *	@brief
+ *	Size of the buffer in bytes `FAny` can store values inline with, without allocating them on the heap. Define it
+ *	before including this header (or globally in your module rules) to override it.
+ */
+#ifndef MCRO_ANY_INLINE_SIZE
+#define MCRO_ANY_INLINE_SIZE 32
+#endif
+
+/** @brief Maximum alignment of values `FAny` can store inline. */
+#ifndef MCRO_ANY_INLINE_ALIGNMENT
+#define MCRO_ANY_INLINE_ALIGNMENT 16
+#endif
+
 namespace Mcro::Any
 {
 	using namespace Mcro::TypeName;
@@ -33,19 +47,23 @@ namespace Mcro::Any
 	/**
 	 *	@brief
 	 *	Give the opportunity to customize object lifespan operations for `FAny` by either specializing this template
-	 *	or just providing functors in-place
+	 *	or just providing functors in-place.
+	 *
+	 *	Functors left empty fall back to the default `new` / `delete` behavior. When both of them are empty `FAny` will
+	 *	use its static per-type operations instead, which doesn't need to store these functors at all.
 	 *	
 	 *	@tparam T  The type being set for an FAny
 	 */
 	template <typename T>
 	struct TAnyTypeFacilities
 	{
-		TFunction<void(T*)> Destruct {[](T* object) { delete object; }};
-		TFunction<T*(T const&)> CopyConstruct {[](T const& object)
+		TFunction<void(T*)> Destruct {};
+		TFunction<T*(T const&)> CopyConstruct {};
+
+		FORCEINLINE bool IsDefault() const
 		{
-			if constexpr (CCopyConstructible<T>) return new T(object); 
-			else return nullptr;
-		}};
+			return !static_cast<bool>(Destruct) && !static_cast<bool>(CopyConstruct);
+		}
 	};
 
 	/** @brief Type facilities for `FAny` enforcing standard memory allocations */
@@ -59,6 +77,60 @@ namespace Mcro::Any
 		}
 	};
 
+	/**
+	 *	@brief
+	 *	Types which may be stored inline in `FAny`, if they fit into its inline buffer. Unreal containers relocate
+	 *	their elements bitwise (with memmove), so an inline value is moved around without running its move
+	 *	constructor. This is only safe by default for trivially copyable types. Specialize it to `true` for other types
+	 *	which are known to be bitwise relocatable (no self-references, no pointers into themselves).
+	 */
+	template <typename T>
+	constexpr bool TAnyInlineAllowed = std::is_trivially_copyable_v<T>;
+
+	/** @brief Types which `FAny` will store inline when they're constructed in-place */
+	template <typename T>
+	concept CAnyInlineStorable =
+		sizeof(T) <= MCRO_ANY_INLINE_SIZE
+		&& alignof(T) <= MCRO_ANY_INLINE_ALIGNMENT
+		&& std::is_nothrow_move_constructible_v<T>
+		&& TAnyInlineAllowed<T>
+	;
+
+	/**
+	 *	@brief
+	 *	Type-erased table of lifespan operations for `FAny`. One constant instance exists for each type and storage
+	 *	method, so `FAny` doesn't need to capture anything for managing its enclosed value.
+	 */
+	struct FAnyOperations
+	{
+		/** @brief The enclosed value is stored inside the `FAny` instance */
+		bool bInline = false;
+
+		/** @brief Destroy the enclosed value and release its memory if it was allocated */
+		void (*Destruct)(FAny& self) = nullptr;
+
+		/** @brief Copy construct the value of `other` into `self`, which is expected to be uninitialized */
+		void (*CopyConstruct)(FAny& self, FAny const& other) = nullptr;
+
+		/** @brief Only for inline values: move construct the value of `other` into `self` then destroy the source */
+		void (*Relocate)(FAny& self, FAny& other) = nullptr;
+	};
+
+	namespace Detail
+	{
+		struct IAnyFacilities
+		{
+			virtual ~IAnyFacilities() = default;
+		};
+
+		template <typename T>
+		struct TAnyFacilitiesHolder : IAnyFacilities
+		{
+			TAnyFacilitiesHolder(TAnyTypeFacilities<T> const& facilities) : Facilities(facilities) {}
+			TAnyTypeFacilities<T> Facilities;
+		};
+	}
+
 	/**
 	 *	@brief
 	 *	A simplistic but type-safe and RAII compliant storage for anything. Enclosed data is owned by this type.
@@ -76,9 +148,25 @@ namespace Mcro::Any
 	 *	`TInherit` has a member alias `using Bases = TTypes<...>` and that can be used by FAny to automatically register
 	 *	base classes as compatible ones.
 	 *
+	 *	Type safety checks don't involve hashing or allocations. The main type and its explicit bases are read from the
+	 *	shared static `FType` of the main type, and only aliases specified later via `WithAlias` are stored per
+	 *	instance, in a small inline array of type-hashes.
+	 *
 	 *	Enclosed value is recommended to be copy constructible. It may yield a runtime error otherwise. Moving an FAny
-	 *	will just transfer ownership of the wrapped object but will not move construct a new object. The source FAny
-	 *	will be reset to an invalid state.
+	 *	holding a heap allocated object will just transfer ownership of the wrapped object but will not move construct
+	 *	a new object. The source FAny will be reset to an invalid state.
+	 *
+	 *	When a value is constructed in-place (with `TInPlaceType`) and it satisfies `CAnyInlineStorable`, it is stored
+	 *	inline without any heap allocation. Inline values are move constructed when the FAny is moved, but containers
+	 *	may still relocate them bitwise, so only trivially copyable types (or types opted-in via `TAnyInlineAllowed`)
+	 *	are stored inline. `IComposable` never relocates its components, so components added by their type (as
+	 *	opposed to adopting a `new` object) take the inline path as well, and copies of the composable class copy
+	 *	them without allocating.
+	 *	@code
+	 *	FAny small(TInPlaceType<FVector>(), 1.0, 2.0, 3.0); // stored inline
+	 *	FAny large(TInPlaceType<FMatrix>());                // doesn't fit, allocated on the heap
+	 *	FAny adopted(new FVector(1.0, 2.0, 3.0));           // existing objects are always kept on the heap
+	 *	@endcode
 	 *
 	 *	@todo
 	 *	C++ 26 has promising proposal for static value-based reflection, which can gather metadata from classes
@@ -91,33 +179,41 @@ namespace Mcro::Any
 	 */
 	struct MCRO_API FAny
 	{
+		static constexpr size_t InlineSize = MCRO_ANY_INLINE_SIZE;
+		static constexpr size_t InlineAlignment = MCRO_ANY_INLINE_ALIGNMENT;
+
 		template <typename T>
 		FAny(T* newObject, TAnyTypeFacilities<T> const& facilities = {})
-			: Storage(newObject)
-			, MainType(TTypeOf<T>)
-			, Destruct([facilities](FAny* self)
+			: MainType(&TTypeOf<T>)
+		{
+			HeapStorage = newObject;
+			if (facilities.IsDefault())
+				Operations = &HeapOperations<T>;
+			else
 			{
-				T* object = static_cast<T*>(self->Storage);
-				facilities.Destruct(object);
-				self->Storage = nullptr;
-			})
-			, CopyConstruct([facilities](FAny* self, FAny const& other)
+				Facilities = MakeShared<Detail::TAnyFacilitiesHolder<T>>(facilities);
+				Operations = &CustomOperations<T>;
+			}
+		}
+
+		/**
+		 *	@brief
+		 *	Construct a new value in-place. If `T` satisfies `CAnyInlineStorable` it is stored inline, otherwise it's
+		 *	allocated on the heap with `new`.
+		 */
+		template <typename T, typename... Args>
+		explicit FAny(TInPlaceType<T>, Args&&... args)
+			: MainType(&TTypeOf<T>)
+		{
+			if constexpr (CAnyInlineStorable<T>)
 			{
-				const T* object = static_cast<const T*>(other.Storage);
-				self->Storage = facilities.CopyConstruct(*object);
-				checkf(self->Storage, TEXT_"Copy constructor failed for %s. Is it deleted?", *TTypeString<T>());
-				
-				CopyTypeInfo(self, &other);
-			})
-		{
-			ValidTypes.Add(MainType);
-			
-			if constexpr (CHasBases<T>)
+				new (InlineStorage) T(FWD(args)...);
+				Operations = &InlineOperations<T>;
+			}
+			else
 			{
-				ForEachExplicitBase<T>([this] <typename Base> ()
-				{
-					AddAlias(TTypeOf<Base>);
-				});
+				HeapStorage = new T(FWD(args)...);
+				Operations = &HeapOperations<T>;
 			}
 		}
 
@@ -126,33 +222,48 @@ namespace Mcro::Any
 		FAny(FAny&& other);
 		~FAny();
 
+		FAny& operator = (FAny const& other);
+		FAny& operator = (FAny&& other);
+
 		template <typename T>
 		const T* TryGet() const
 		{
-			return ValidTypes.Contains(TTypeOf<T>)
-				? static_cast<const T*>(Storage)
+			return IsValidAs(TTypeOf<T>.Hash)
+				? static_cast<const T*>(GetStorage())
 				: nullptr;
 		}
 
 		template <typename T>
 		T* TryGet()
 		{
-			return ValidTypes.Contains(TTypeOf<T>)
-				? static_cast<T*>(Storage)
+			return IsValidAs(TTypeOf<T>.Hash)
+				? static_cast<T*>(GetStorage())
 				: nullptr;
 		}
+
+		/** @brief Check if the enclosed value can be safely accessed via the type represented by given type-hash */
+		FORCEINLINE bool IsValidAs(FTypeHash typeHash) const
+		{
+			if (!MainType) return false;
+			if (MainType->Hash == typeHash) return true;
+			for (const FTypeHash base : *MainType)
+				if (base == typeHash) return true;
+			for (const FTypeHash alias : Aliases)
+				if (alias == typeHash) return true;
+			return false;
+		}
 		
 		/** @brief Specify one type the enclosed value can be safely cast to, and is valid to be used with `TryGet`. */
 		template <typename T, typename Self>
 		decltype(auto) WithAlias(this Self&& self)
 		{
-			self.AddAlias(TTypeOf<T>);
+			self.AddAlias(TTypeOf<T>.Hash);
 			
 			if constexpr (CHasBases<T>)
 			{
 				ForEachExplicitBase<T>([&] <typename Base> ()
 				{
-					self.AddAlias(TTypeOf<Base>);
+					self.AddAlias(TTypeOf<Base>.Hash);
 				});
 			}
 			return FWD(self);
@@ -162,25 +273,131 @@ namespace Mcro::Any
 		template <typename Self, typename... T>
 		decltype(auto) With(this Self&& self, TTypes<T...>&&)
 		{
-			(self.AddAlias(TTypeOf<T>), ...);
+			(self.AddAlias(TTypeOf<T>.Hash), ...);
 			return FWD(self);
 		}
 
-		FORCEINLINE bool IsValid() const { return static_cast<bool>(Storage); }
-		FORCEINLINE FType GetType() const { return MainType; }
-		FORCEINLINE TSet<FType> const& GetValidTypes() const { return ValidTypes; }
+		FORCEINLINE bool IsValid() const { return Operations && (Operations->bInline || HeapStorage); }
+		FORCEINLINE bool IsInline() const { return Operations && Operations->bInline; }
+		FORCEINLINE FType GetType() const { return MainType ? *MainType : FType(); }
+
+		/** @brief Type-hashes of aliases which were specified after construction (not including explicit bases) */
+		FORCEINLINE TArrayView<const FTypeHash> GetExtraAliases() const { return Aliases; }
 		
 	private:
-		void AddAlias(FType const& alias);
-		static void CopyTypeInfo(FAny* self, const FAny* other);
-		void Reset();
+		FORCEINLINE void* GetStorage() { return IsInline() ? static_cast<void*>(InlineStorage) : HeapStorage; }
+		FORCEINLINE const void* GetStorage() const { return IsInline() ? static_cast<const void*>(InlineStorage) : HeapStorage; }
+
+		template <typename T>
+		static void CheckCopyResult(FAny const& self)
+		{
+			checkf(self.HeapStorage, TEXT_"Copy constructor failed for %s. Is it deleted?", *TTypeString<T>());
+		}
+
+		template <typename T>
+		static void HeapDestruct(FAny& self)
+		{
+			delete static_cast<T*>(self.HeapStorage);
+			self.HeapStorage = nullptr;
+		}
+
+		template <typename T>
+		static void HeapCopyConstruct(FAny& self, FAny const& other)
+		{
+			if constexpr (CCopyConstructible<T>)
+				self.HeapStorage = new T(*static_cast<const T*>(other.HeapStorage));
+			CheckCopyResult<T>(self);
+		}
+
+		template <typename T>
+		static void InlineDestruct(FAny& self)
+		{
+			static_cast<T*>(static_cast<void*>(self.InlineStorage))->~T();
+		}
+
+		template <typename T>
+		static void InlineCopyConstruct(FAny& self, FAny const& other)
+		{
+			if constexpr (CCopyConstructible<T>)
+				new (self.InlineStorage) T(*static_cast<const T*>(static_cast<const void*>(other.InlineStorage)));
+			else
+				checkf(false, TEXT_"Copy constructor failed for %s. Is it deleted?", *TTypeString<T>());
+		}
+
+		template <typename T>
+		static void InlineRelocate(FAny& self, FAny& other)
+		{
+			T* source = static_cast<T*>(static_cast<void*>(other.InlineStorage));
+			new (self.InlineStorage) T(MoveTemp(*source));
+			source->~T();
+		}
+
+		template <typename T>
+		static TAnyTypeFacilities<T> const& GetFacilities(FAny const& self)
+		{
+			return static_cast<Detail::TAnyFacilitiesHolder<T> const*>(self.Facilities.Get())->Facilities;
+		}
+
+		template <typename T>
+		static void CustomDestruct(FAny& self)
+		{
+			auto const& facilities = GetFacilities<T>(self);
+			T* object = static_cast<T*>(self.HeapStorage);
+			if (facilities.Destruct) facilities.Destruct(object);
+			else delete object;
+			self.HeapStorage = nullptr;
+		}
+
+		template <typename T>
+		static void CustomCopyConstruct(FAny& self, FAny const& other)
+		{
+			auto const& facilities = GetFacilities<T>(self);
+			const T* object = static_cast<const T*>(other.HeapStorage);
+			if (facilities.CopyConstruct)
+				self.HeapStorage = facilities.CopyConstruct(*object);
+			else if constexpr (CCopyConstructible<T>)
+				self.HeapStorage = new T(*object);
+			CheckCopyResult<T>(self);
+		}
+
+		template <typename T>
+		static constexpr FAnyOperations HeapOperations {
+			.bInline = false,
+			.Destruct = &HeapDestruct<T>,
+			.CopyConstruct = &HeapCopyConstruct<T>
+		};
+
+		template <typename T>
+		static constexpr FAnyOperations InlineOperations {
+			.bInline = true,
+			.Destruct = &InlineDestruct<T>,
+			.CopyConstruct = &InlineCopyConstruct<T>,
+			.Relocate = &InlineRelocate<T>
+		};
+
+		template <typename T>
+		static constexpr FAnyOperations CustomOperations {
+			.bInline = false,
+			.Destruct = &CustomDestruct<T>,
+			.CopyConstruct = &CustomCopyConstruct<T>
+		};
 		
-		void* Storage = nullptr;
-		FType MainType {};
+		void AddAlias(FTypeHash alias);
+		void CopyFrom(FAny const& other);
+		void MoveFrom(FAny& other);
+		void Destroy();
+		void Reset();
+
+		union
+		{
+			void* HeapStorage = nullptr;
+			alignas(MCRO_ANY_INLINE_ALIGNMENT) uint8 InlineStorage[MCRO_ANY_INLINE_SIZE];
+		};
 		
-		TFunction<void(FAny* self)> Destruct {};
-		TFunction<void(FAny* self, FAny const& other)> CopyConstruct {};
+		const FAnyOperations* Operations = nullptr;
+		TSharedPtr<Detail::IAnyFacilities> Facilities {};
+		const FType* MainType = nullptr;
 		
-		TSet<FType> ValidTypes {};
+		TArray<FTypeHash, TInlineAllocator<4>> Aliases {};
 	};
 }
\ No newline at end of file
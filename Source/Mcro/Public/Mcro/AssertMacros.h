@@ -22,11 +22,36 @@
  *	them removed many years from my expected life-span.
  */
 
+#include <atomic>
+
 #include "CoreMinimal.h"
 #include "Mcro/Error.h"
 #include "Mcro/Macros.h"
 #include "Logging/LogMacros.h"
 
+#ifndef MCRO_ASSERT_MIN_REPORT_INTERVAL
+/**
+ *	@brief
+ *	Failing assertions at the same call-site are submitted as errors at most once per this many seconds. Failures in
+ *	between are only counted (the first one of them is logged in a single line), and their count is attached to the
+ *	next submitted error, or reported as a single aggregate error once the interval has passed without another
+ *	failure. Set it to 0 to submit every failure.
+ *
+ *	Failures which end the session (crashing, or quitting outside of PIE, or the first quitting failure of a PIE
+ *	session) are never throttled.
+ */
+#define MCRO_ASSERT_MIN_REPORT_INTERVAL 1.0
+#endif
+
+#ifndef MCRO_ASSERT_MAX_REPORT_INTERVAL
+/**
+ *	@brief
+ *	The report interval of a call-site is doubled every time failures were suppressed there since its last report,
+ *	up until this many seconds.
+ */
+#define MCRO_ASSERT_MAX_REPORT_INTERVAL 60.0
+#endif
+
 /** @brief Do not use this namespace directly use `ASSERT_QUIT|CRASH` macros instead */
 namespace Mcro::AssertMacros
 {
@@ -34,25 +59,81 @@ namespace Mcro::AssertMacros
 
 	namespace Detail
 	{
+		/**
+		 *	Bookkeeping of a single assertion call-site, so failures repeated in tight loops don't construct, format
+		 *	and display thousands of identical errors. Only one is declared per assertion macro expansion as a
+		 *	function local static.
+		 */
+		class MCRO_API FAssertSite : public FNoncopyable
+		{
+		public:
+			FAssertSite(std::source_location const& location = std::source_location::current());
+			~FAssertSite();
+
+			/**
+			 *	@return
+			 *	True if an error should be submitted for the current failure, false when it's throttled. Failures
+			 *	ending the session are never throttled, as their error is the last word of the session: crashing ones,
+			 *	and fatal ones unless a PIE session is already ending because of an earlier failure. The first
+			 *	throttled failure of a report interval is logged in a single line, the rest are only counted.
+			 */
+			bool ShouldSubmit(EErrorSeverity severity);
+
+			/**
+			 *	Report the failures suppressed since the last report, if the report interval has passed without another
+			 *	submitted failure. Called periodically while this site has suppressed failures, so a burst of failures
+			 *	which stops before the interval has passed is still accounted for. They're reported via
+			 *	`IError::OnErrorReported` as a single `FAssertion` without stack traces, and logged in a single line.
+			 *
+			 *	@param  deferredReport  If given, the aggregate error is stored there instead of being reported
+			 *	@return True if nothing is left to report
+			 */
+			bool FlushSuppressed(double now, IErrorPtr* deferredReport = nullptr);
+
+			/**
+			 *	Get the number of failures suppressed since the last submitted error, and adjust the report interval
+			 *	according to it. Call it only when an error is submitted.
+			 */
+			int32 ConsumeSuppressed();
+
+			/** The number of failures at this call-site during the lifetime of the process */
+			FORCEINLINE uint64 GetTotalFailures() const { return TotalFailures.load(std::memory_order_relaxed); }
+
+			std::source_location const Location;
+
+		private:
+			std::atomic<double> NextSubmitTime { 0.0 };
+			std::atomic<double> Interval { MCRO_ASSERT_MIN_REPORT_INTERVAL };
+			std::atomic<int32> Suppressed { 0 };
+			std::atomic<EErrorSeverity> SuppressedSeverity { EErrorSeverity::Recoverable };
+			std::atomic<uint64> TotalFailures { 0 };
+		};
+
 		MCRO_API void SubmitError(
+			FAssertSite& site,
 			EErrorSeverity severity,
 			FString const& codeContext,
 			bool async, bool important,
-			TUniqueFunction<void(IErrorRef const&)>&& extraSetup,
-			std::source_location const& location = std::source_location::current()
+			TUniqueFunction<void(IErrorRef const&)>&& extraSetup
 		);
 		MCRO_API bool IsRunningPIE();
+		MCRO_API bool IsEndingPIE();
 		MCRO_API void StopPie();
 	}
 }
 
-#define MCRO_ASSERT_SUBMIT_ERROR(condition, severity, async, important, ...) \
-	Mcro::AssertMacros::Detail::SubmitError(                                 \
-		Mcro::Error::EErrorSeverity::severity,                               \
-		PREPROCESSOR_TO_TEXT(condition),                                     \
-		async, important,                                                    \
-		[&](Mcro::Error::IErrorRef const& error) { (error __VA_ARGS__); }    \
-	);                                                                      //
+#define MCRO_ASSERT_SUBMIT_ERROR(condition, severity, async, important, ...)      \
+	{                                                                             \
+		static Mcro::AssertMacros::Detail::FAssertSite mcroAssertSite;            \
+		if (mcroAssertSite.ShouldSubmit(Mcro::Error::EErrorSeverity::severity))   \
+			Mcro::AssertMacros::Detail::SubmitError(                              \
+				mcroAssertSite,                                                   \
+				Mcro::Error::EErrorSeverity::severity,                            \
+				PREPROCESSOR_TO_TEXT(condition),                                  \
+				async, important,                                                 \
+				[&](Mcro::Error::IErrorRef const& error) { (error __VA_ARGS__); } \
+			);                                                                    \
+	}                                                                             //
 
 #define MCRO_ASSERT_CRASH_METHOD                                   \
 	UE_LOG(LogTemp, Fatal,                                         \
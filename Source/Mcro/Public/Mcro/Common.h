@@ -26,15 +26,19 @@
 #include "Mcro/Delegates/EventDelegate.h"
 #include "Mcro/Delegates/DelegateFrom.h"
 #include "Mcro/Delegates/AsNative.h"
+#include "Mcro/Delegates/QueuedEventDelegate.h"
 #include "Mcro/Error/BlueprintStackTrace.h"
 #include "Mcro/Error/CppException.h"
 #include "Mcro/Error/CppStackTrace.h"
 #include "Mcro/Error/ErrorManager.h"
+#include "Mcro/Error/ErrorSerializer.h"
 #include "Mcro/Error/PlainTextComponent.h"
 #include "Mcro/Error/SErrorDisplay.h"
 #include "Mcro/Error/SPlainTextDisplay.h"
 #include "Mcro/Modules.h"
 #include "Mcro/Observable.h"
+#include "Mcro/Observable/CollectionState.h"
+#include "Mcro/Observable/ComputedState.h"
 #include "Mcro/Rendering/Textures.h"
 #include "Mcro/Slate.h"
 #include "Mcro/Subsystems.h"
@@ -26,6 +26,8 @@
 #include "Mcro/Ansi/New.h"
 #include "Mcro/Badge.h"
 #include "Mcro/Composition.h"
+#include "Mcro/Composition/StaticComposable.h"
+#include "Mcro/Composition/Registry.h"
 #include "Mcro/Concepts.h"
 #include "Mcro/Construct.h"
 #include "Mcro/Enums.h"
@@ -27,6 +27,7 @@ namespace Mcro::Composition
 	using namespace Mcro::Range;
 
 	class IComposable;
+	class FComposableRegistry;
 
 	/**
 	 *	@brief
@@ -118,6 +119,213 @@ namespace Mcro::Composition
 	template <typename T, typename Composition>
 	concept CCompatibleComponent = !CStrictComponent<T> || CCompatibleStrictComponent<T, Composition>;
 
+	namespace Detail
+	{
+		struct FComponentLogistics
+		{
+			void (*Copy)(IComposable* target, FAny const& targetComponent, FAny const& sourceComponent) = nullptr;
+			void (*Move)(IComposable* target, FAny& component) = nullptr;
+		};
+
+		/**
+		 *	@brief
+		 *	Append-only storage of the components of an `IComposable`, in pages which are never reallocated. The sorted
+		 *	component table only points into it, so reordering the table on insertion doesn't move any component.
+		 *	Copies of a composable class store all of their components in a single page.
+		 */
+		class MCRO_API FComponentStorage
+		{
+		public:
+			FComponentStorage() = default;
+			FComponentStorage(FComponentStorage const&) = delete;
+			FComponentStorage(FComponentStorage&& other) noexcept;
+			FComponentStorage& operator = (FComponentStorage const&) = delete;
+			FComponentStorage& operator = (FComponentStorage&& other) noexcept;
+			~FComponentStorage();
+
+			/** Make sure the next `count` components are stored in the same page */
+			void Reserve(int32 count);
+
+			/** Destroy all components and release their pages */
+			void Empty();
+
+			template <typename... Args>
+			FAny& Emplace(Args&&... args)
+			{
+				return *new (AllocateSlot()) FAny(FWD(args)...);
+			}
+
+		private:
+			struct FPage
+			{
+				FAny* Items = nullptr;
+				int32 Num = 0;
+				int32 Capacity = 0;
+			};
+
+			static constexpr int32 MinPageCapacity = 4;
+			
+			TArray<FPage, TInlineAllocator<2>> Pages;
+
+			void AddPage(int32 capacity);
+			FAny* AllocateSlot();
+		};
+
+		/**
+		 *	@brief
+		 *	An entry of the sorted component table of `IComposable`.
+		 *
+		 *	The table itself is relocated whenever a component is inserted before others, therefore it only points to
+		 *	its component, which is either stored in the `FComponentStorage` of the composable class, or boxed in its
+		 *	own shared storage when it's shared with copies of the composable class (copy-on-write).
+		 */
+		struct FComponentEntry
+		{
+			FTypeHash Type = 0;
+
+			/** Points into the component storage of the owning composable class, or into `Shared` */
+			FAny* Component = nullptr;
+
+			/** The box of the component when it is shared with copies of its composable class */
+			TSharedPtr<FAny> Shared;
+			
+			FComponentLogistics Logistics {};
+
+			FORCEINLINE FAny* Get() { return Component; }
+			FORCEINLINE const FAny* Get() const { return Component; }
+			FORCEINLINE bool IsShared() const { return Shared.IsValid(); }
+			FORCEINLINE bool CanShare() const { return !Logistics.Copy && !Logistics.Move; }
+
+			/**
+			 *	Let copies of the composable class share the component. It is moved into its own box for that, the empty
+			 *	source is left in the component storage.
+			 */
+			void Share()
+			{
+				if (!CanShare() || IsShared()) return;
+				Shared = MakeShared<FAny>(MoveTemp(*Component));
+				Component = Shared.Get();
+			}
+
+			/** Clone a component if it is shared with other composable classes, before it gets modified */
+			void Detach()
+			{
+				if (IsShared() && !Shared.IsUnique())
+				{
+					Shared = MakeShared<FAny>(*Shared);
+					Component = Shared.Get();
+				}
+			}
+		};
+
+		struct FComponentAlias
+		{
+			FTypeHash Alias = 0;
+			int32 Index = INDEX_NONE;
+		};
+
+		/** Where a composable class is stored in an `FComposableRegistry`. Copies are not registered automatically. */
+		struct FComposableRegistryLink
+		{
+			FComposableRegistry* Registry = nullptr;
+			int32 Archetype = INDEX_NONE;
+			int32 Row = INDEX_NONE;
+
+			FComposableRegistryLink() = default;
+			FComposableRegistryLink(FComposableRegistryLink const&) {}
+			FComposableRegistryLink& operator = (FComposableRegistryLink const&) { return *this; }
+		};
+	}
+
+	/**
+	 *	@brief
+	 *	A lightweight, non-owning view of components matching a type, directly over the storage of an `IComposable`.
+	 *	Unlike the `ranges::any_view` returned by `GetComponents`, this involves no type erasure and no allocations.
+	 *	It is a range-v3 view, so it can be piped into further views as well.
+	 *
+	 *	The exact component (if it exists) always comes first, then the components which were registered with `T` as
+	 *	an alias.
+	 *
+	 *	@warning
+	 *	The view is invalidated when components are added to, or removed from the viewed composable class.
+	 *
+	 *	@tparam T  The component type the elements are resolved as, or `FAny` to get the boxed components.
+	 */
+	template <typename T>
+	struct TComponentView : ranges::view_base
+	{
+		TComponentView() = default;
+		TComponentView(FAny* exact, Detail::FComponentEntry* entries, TArrayView<const Detail::FComponentAlias> aliases)
+			: Exact(exact)
+			, Entries(entries)
+			, Aliases(aliases.GetData())
+			, AliasCount(aliases.Num())
+		{}
+
+		struct FIterator;
+
+		FORCEINLINE int32 Num() const { return (Exact ? 1 : 0) + AliasCount; }
+		FORCEINLINE bool IsEmpty() const { return Num() == 0; }
+
+		/** @brief Get the component at given index of this view. Index must be in bounds. */
+		T* operator [] (int32 index) const
+		{
+			checkSlow(index >= 0 && index < Num());
+			if (Exact)
+			{
+				if (index == 0) return Resolve(Exact);
+				--index;
+			}
+			return Resolve(Entries[Aliases[index].Index].Get());
+		}
+
+		/** @brief Get the first component of this view, or nullptr if the view is empty. */
+		FORCEINLINE T* First() const
+		{
+			if (Exact) return Resolve(Exact);
+			return AliasCount > 0 ? Resolve(Entries[Aliases[0].Index].Get()) : nullptr;
+		}
+
+		FIterator begin() const { return FIterator(*this, 0); }
+		FIterator end() const { return FIterator(*this, Num()); }
+
+	private:
+		static FORCEINLINE T* Resolve(FAny* component)
+		{
+			if constexpr (CSameAsDecayed<T, FAny>) return component;
+			else return component->TryGet<std::decay_t<T>>();
+		}
+		
+		FAny* Exact = nullptr;
+		Detail::FComponentEntry* Entries = nullptr;
+		const Detail::FComponentAlias* Aliases = nullptr;
+		int32 AliasCount = 0;
+	};
+
+	template <typename T>
+	struct TComponentView<T>::FIterator
+	{
+		using value_type = T*;
+		using reference = T*;
+		using pointer = void;
+		using difference_type = std::ptrdiff_t;
+		using iterator_category = std::forward_iterator_tag;
+
+		FIterator() = default;
+		FIterator(TComponentView const& view, int32 position) : View(view), Position(position) {}
+
+		T* operator * () const { return View[Position]; }
+		FIterator& operator ++ () { ++Position; return *this; }
+		FIterator operator ++ (int) { FIterator previous = *this; ++Position; return previous; }
+		
+		friend bool operator == (FIterator const& l, FIterator const& r) { return l.Position == r.Position; }
+		friend bool operator != (FIterator const& l, FIterator const& r) { return l.Position != r.Position; }
+		
+	private:
+		TComponentView View {};
+		int32 Position = 0;
+	};
+
 	/**
 	 *	@brief  A base class which can bring type based class-composition to a derived class
 	 *
@@ -270,30 +478,54 @@ namespace Mcro::Composition
 	{
 		FTypeHash LastAddedComponentHash = 0;
 
-		struct FComponentLogistics
-		{
-			TFunction<void(IComposable* target, FAny const& targetComponent)> Copy;
-			TFunction<void(IComposable* target)> Move;
-		};
+		using FComponentEntry = Detail::FComponentEntry;
+		using FComponentAlias = Detail::FComponentAlias;
+
+		/**
+		 *	Components are stored in one contiguous table sorted by their type-hash. Aliases are stored in another
+		 *	table sorted by the alias type-hash, where each entry points to an index of the component table. This way
+		 *	all components of a given alias are represented by one contiguous span.
+		 */
+		mutable TArray<FComponentEntry> Components;
+		TArray<FComponentAlias> ComponentAliases;
+		Detail::FComponentStorage ComponentStorage;
+		bool bCopyOnWrite = false;
+		Detail::FComposableRegistryLink RegistryLink;
 
-		// Using ANSI allocators here because I've seen Unreal default allocators fail when moving or copying composable classes
-		mutable TMap<FTypeHash, FAny> Components;
-		mutable TMap<FTypeHash, FComponentLogistics> ComponentLogistics;
-		mutable TMap<FTypeHash, TArray<FTypeHash>> ComponentAliases;
+		friend class FComposableRegistry;
 
+		int32 FindComponentIndex(FTypeHash typeHash) const;
+		int32 GetComponentInsertIndex(FTypeHash typeHash) const;
+		TArrayView<const FComponentAlias> GetAliasSpan(FTypeHash typeHash) const;
+		void OnComponentInserted(int32 index);
+		void DetachComponents(FTypeHash typeHash);
+
+		template <typename T>
+		TComponentView<T> MakeComponentView(FTypeHash typeHash) const
+		{
+			const int32 index = FindComponentIndex(typeHash);
+			return TComponentView<T>(
+				index != INDEX_NONE ? Components[index].Get() : nullptr,
+				Components.GetData(),
+				GetAliasSpan(typeHash)
+			);
+		}
+		
 		bool HasExactComponent(FTypeHash typeHash) const;
-		bool HasComponentAliasUnchecked(FTypeHash typeHash) const;
 		bool HasComponentAlias(FTypeHash typeHash) const;
 		void AddComponentAlias(FTypeHash mainType, FTypeHash validAs);
 
 		void NotifyCopyComponents(IComposable const& other);
 		void NotifyMoveComponents(IComposable&& other);
+		void NotifyRegistry();
 		void ResetComponents();
 		
 		template <typename ValidAs>
 		void AddComponentAlias(FTypeHash mainType)
 		{
-			Components[mainType].WithAlias<ValidAs>();
+			FComponentEntry& entry = Components[FindComponentIndex(mainType)];
+			entry.Detach();
+			entry.Get()->WithAlias<ValidAs>();
 			AddComponentAlias(mainType, TTypeHash<ValidAs>);
 
 			if constexpr (CHasBases<ValidAs>)
@@ -305,6 +537,87 @@ namespace Mcro::Composition
 			}
 		}
 		
+		template <typename MainType, typename Self, typename BoxArg>
+		void EmplaceComponent(this Self&& self, BoxArg&& boxArg)
+		{
+			ASSERT_CRASH(!self.HasExactComponent(TTypeHash<MainType>),
+				->WithMessageF(
+					TEXT_"{0} cannot be added because another component already exists under that type.",
+					TTypeName<MainType>
+				)
+				->WithDetailsF(TEXT_
+					"Try wrapping your component in an empty derived type, and register it with its base type {0} as its"
+					" alias. Later on both the current and the already existing component can be accessed via"
+					" `GetComponents<{0}>()` which returns a range of all matching components.",
+					TTypeName<MainType>
+				)
+			);
+			
+			FComponentEntry entry { .Type = TTypeHash<MainType> };
+			if constexpr (CCopyAwareComponent<MainType, Self> || CMoveAwareComponent<MainType, Self>)
+			{
+				// Components are resolved only when they're needed, because copies of the composable class store their
+				// components separately.
+				entry.Logistics = {
+					.Copy = [](IComposable* target, FAny const& targetBoxedComponent, FAny const& sourceBoxedComponent)
+					{
+						// TODO: Provide safe parent reference mechanism without smart pointers because this doesn't seem to work well
+						if constexpr (CCopyAwareComponent<MainType, Self>)
+						{
+							auto targetComponent = AsMutablePtr(targetBoxedComponent.TryGet<MainType>());
+							auto sourceComponent = sourceBoxedComponent.TryGet<MainType>();
+							ASSERT_CRASH(targetComponent && sourceComponent,
+								->WithMessageF(
+									TEXT_"{0} component cannot be copied as its destination wrapper was incompatible.",
+									TTypeName<MainType>
+								)
+							);
+							targetComponent->OnCopiedAt(*static_cast<std::decay_t<Self>*>(target), *sourceComponent);
+						}
+					},
+					.Move = [](IComposable* target, FAny& movedBoxedComponent)
+					{
+						// TODO: Provide safe parent reference mechanism without smart pointers because this doesn't seem to work well
+						if constexpr (CMoveAwareComponent<MainType, Self>)
+						{
+							if (auto component = movedBoxedComponent.TryGet<MainType>())
+								component->OnMovedAt(*static_cast<std::decay_t<Self>*>(target));
+						}
+					}
+				};
+			}
+
+			// In copy-on-write mode new components are boxed for sharing right away
+			if (self.bCopyOnWrite && entry.CanShare())
+			{
+				entry.Shared = MakeShared<FAny>(FWD(boxArg));
+				entry.Component = entry.Shared.Get();
+			}
+			else entry.Component = &self.ComponentStorage.Emplace(FWD(boxArg));
+			
+			const int32 index = self.GetComponentInsertIndex(TTypeHash<MainType>);
+			self.Components.Insert(MoveTemp(entry), index);
+			self.OnComponentInserted(index);
+			
+			FAny& boxedComponent = *self.Components[index].Get();
+			MainType* unboxedComponent = boxedComponent.TryGet<MainType>();
+
+			self.LastAddedComponentHash = TTypeHash<MainType>;
+			if constexpr (CHasBases<MainType>)
+			{
+				ForEachExplicitBase<MainType>([&] <typename Base> ()
+				{
+					// FAny also deals with CHasBases so we can skip explicitly registering them here
+					self.AddComponentAlias(TTypeHash<MainType>, TTypeHash<Base>);
+				});
+			}
+			self.NotifyRegistry();
+
+			if (self.OnComponentAdded) self.OnComponentAdded(boxedComponent);
+			if constexpr (CCompatibleExplicitComponent<MainType, Self>)
+				unboxedComponent->OnCreatedAt(self);
+		}
+
 		ranges::any_view<FAny*> GetExactComponent(FTypeHash typeHash) const;
 		ranges::any_view<FAny*> GetAliasedComponents(FTypeHash typeHash) const;
 
@@ -326,6 +639,7 @@ namespace Mcro::Composition
 		IComposable() = default;
 		IComposable(const IComposable& other);
 		IComposable(IComposable&& other) noexcept;
+		~IComposable();
 
 		/**
 		 *	@brief   Get components determined at runtime
@@ -334,6 +648,127 @@ namespace Mcro::Composition
 		 */
 		ranges::any_view<FAny*> GetComponentsDynamic(FTypeHash typeHash) const;
 
+		/**
+		 *	@brief   Get components determined at runtime, without type erasure or allocations
+		 *	@param   typeHash  The runtime determined type-hash the desired components are represented with
+		 *	@return  A read-only view of all the boxed components matched with given type-hash. See `TComponentView`
+		 */
+		FORCEINLINE TComponentView<const FAny> QueryComponentsDynamic(FTypeHash typeHash) const
+		{
+			return MakeComponentView<const FAny>(typeHash);
+		}
+
+		/**
+		 *	@brief
+		 *	Get components determined at runtime, without type erasure or allocations. In copy-on-write mode the
+		 *	matched components are cloned first if they're shared with other composable classes.
+		 *	
+		 *	@param   typeHash  The runtime determined type-hash the desired components are represented with
+		 *	@return  A view of all the boxed components matched with given type-hash. See `TComponentView`
+		 */
+		FORCEINLINE TComponentView<FAny> QueryComponentsDynamic(FTypeHash typeHash)
+		{
+			if (bCopyOnWrite) DetachComponents(typeHash);
+			return MakeComponentView<FAny>(typeHash);
+		}
+
+		/**
+		 *	@brief
+		 *	Get all components added matching~ or aliased by the given type, without type erasure or allocations.
+		 *	Prefer this over `GetComponents` on hot paths.
+		 *
+		 *	@tparam T  Desired component type.
+		 *
+		 *	@return
+		 *	A read-only view of all the matched components. The exact component comes first if it exists. See
+		 *	`TComponentView`
+		 */
+		template <typename T>
+		TComponentView<const T> QueryComponents() const
+		{
+			return MakeComponentView<const T>(TTypeHash<T>);
+		}
+
+		/**
+		 *	@brief
+		 *	Get all components added matching~ or aliased by the given type, without type erasure or allocations.
+		 *	Prefer this over `GetComponents` on hot paths. In copy-on-write mode the matched components are cloned
+		 *	first if they're shared with other composable classes.
+		 *
+		 *	@tparam T  Desired component type.
+		 *
+		 *	@return
+		 *	A view of all the matched components. The exact component comes first if it exists. See `TComponentView`
+		 */
+		template <typename T>
+		TComponentView<T> QueryComponents()
+		{
+			if (bCopyOnWrite) DetachComponents(TTypeHash<T>);
+			return MakeComponentView<T>(TTypeHash<T>);
+		}
+
+		/**
+		 *	@brief
+		 *	Share components with copies of this composable class, instead of copying them, until they're accessed
+		 *	mutably (copy-on-write). This is inherited by the copies of this composable class. Use it for prototypes
+		 *	which are cloned in bulk.
+		 *
+		 *	Components are accessed mutably via the non-const overloads of `Get`, `TryGet`, `QueryComponents` and
+		 *	`QueryComponentsDynamic`. Components which are notified about copies or moves (`OnCopiedAt` / `OnMovedAt`)
+		 *	are never shared, as they're expected to hold state about their parent.
+		 *
+		 *	@warning
+		 *	`GetComponents` and `GetComponentsDynamic` expose shared components directly, don't modify components through
+		 *	them in copy-on-write mode. Mutable access detaches a shared component into a new box, so pointers taken to
+		 *	it before that will keep pointing to the still shared instance. For the same reason, existing components are
+		 *	moved into their shared boxes when this is called, so enable copy-on-write before taking pointers to them.
+		 */
+		void EnableCopyOnWrite();
+
+		/** @brief Are components shared between copies of this composable class until they're accessed mutably */
+		FORCEINLINE bool IsCopyOnWrite() const { return bCopyOnWrite; }
+
+		/**
+		 *	@brief
+		 *	Share components with copies of this composable class until they're accessed mutably, with a fluent API.
+		 *	See `EnableCopyOnWrite`.
+		 *
+		 *	This overload is available for composable classes which also inherit from `TSharedFromThis`.
+		 *
+		 *	@tparam Self  Deducing this
+		 *	@param  self  Deducing this
+		 *
+		 *	@return
+		 *	If the composable class also inherits from `TSharedFromThis` return a shared ref.
+		 */
+		template <CSharedFromThis Self>
+		auto WithCopyOnWrite(this Self&& self)
+		{
+			self.EnableCopyOnWrite();
+			return SharedSelf(&self);
+		}
+
+		/**
+		 *	@brief
+		 *	Share components with copies of this composable class until they're accessed mutably, with a fluent API.
+		 *	See `EnableCopyOnWrite`.
+		 *
+		 *	This overload is available for composable classes which are not explicitly meant to be used with shared pointers.
+		 *
+		 *	@tparam Self  Deducing this
+		 *	@param  self  Deducing this
+		 *
+		 *	@return
+		 *	Perfect-forwarded self.
+		 */
+		template <typename Self>
+		requires (!CSharedFromThis<Self>)
+		decltype(auto) WithCopyOnWrite(this Self&& self)
+		{
+			self.EnableCopyOnWrite();
+			return FWD(self);
+		}
+
 		/**
 		 *	@brief
 		 *	Add a component to this composable class.
@@ -355,69 +790,16 @@ namespace Mcro::Composition
 		void AddComponent(this Self&& self, MainType* newComponent, TAnyTypeFacilities<MainType> const& facilities = {})
 		{
 			ASSERT_CRASH(newComponent);
-			ASSERT_CRASH(!self.HasExactComponent(TTypeHash<MainType>),
-				->WithMessageF(
-					TEXT_"{0} cannot be added because another component already exists under that type.",
-					TTypeName<MainType>
-				)
-				->WithDetailsF(TEXT_
-					"Try wrapping your component in an empty derived type, and register it with its base type {0} as its"
-					" alias. Later on both the current and the already existing component can be accessed via"
-					" `GetComponents<{0}>()` which returns a range of all matching components.",
-					TTypeName<MainType>
-				)
-			);
-			
-			FAny& boxedComponent = self.Components.Add(TTypeHash<MainType>, FAny(newComponent, facilities));
-			MainType* unboxedComponent = boxedComponent.TryGet<MainType>();
-
-			self.LastAddedComponentHash = TTypeHash<MainType>;
-			if constexpr (CHasBases<MainType>)
-			{
-				ForEachExplicitBase<MainType>([&] <typename Base> ()
-				{
-					// FAny also deals with CHasBases so we can skip explicitly registering them here
-					self.AddComponentAlias(TTypeHash<MainType>, TTypeHash<Base>);
-				});
-			}
-
-			if (self.OnComponentAdded) self.OnComponentAdded(boxedComponent);
-			if constexpr (CCompatibleExplicitComponent<MainType, Self>)
-			{
-				unboxedComponent->OnCreatedAt(self);
-				if constexpr (CCopyAwareComponent<MainType, Self> || CMoveAwareComponent<MainType, Self>)
-				{
-					self.ComponentLogistics.Add(TTypeHash<MainType>, {
-						.Copy = [unboxedComponent](IComposable* target, FAny const& targetBoxedComponent)
-						{
-							// TODO: Provide safe parent reference mechanism without smart pointers because this doesn't seem to work well
-							if constexpr (CCopyAwareComponent<MainType, Self>)
-							{
-								auto targetComponent = AsMutablePtr(targetBoxedComponent.TryGet<MainType>());
-								ASSERT_CRASH(targetComponent,
-									->WithMessageF(
-										TEXT_"{0} component cannot be copied as its destination wrapper was incompatible.",
-										TTypeName<MainType>
-									)
-								);
-								targetComponent->OnCopiedAt(*static_cast<Self*>(target), *unboxedComponent);
-							}
-						},
-						.Move = [unboxedComponent](IComposable* target)
-						{
-							// TODO: Provide safe parent reference mechanism without smart pointers because this doesn't seem to work well
-							if constexpr (CMoveAwareComponent<MainType, Self>)
-								unboxedComponent->OnMovedAt(*static_cast<Self*>(target));
-						}
-					});
-				}
-			}
+			FWD(self).template EmplaceComponent<MainType>(FAny(newComponent, facilities));
 		}
 		
 		/**
 		 *	@brief
 		 *	Add a default constructed component to this composable class. 
 		 *
+		 *	Without custom facilities the component is constructed in-place, and small components (satisfying
+		 *	`CAnyInlineStorable`) are stored inline in their `FAny` without a separate heap allocation.
+		 *
 		 *	@tparam MainType  The exact component type
 		 *	@tparam     Self  Deducing this
 		 *	@param      self  Deducing this
@@ -429,7 +811,10 @@ namespace Mcro::Composition
 		requires CCompatibleComponent<MainType, Self>
 		void AddComponent(this Self&& self, TAnyTypeFacilities<MainType> const& facilities = {})
 		{
-			FWD(self).template AddComponent<MainType, Self>(new MainType(), facilities);
+			if (facilities.IsDefault())
+				FWD(self).template EmplaceComponent<MainType>(TInPlaceType<MainType>());
+			else
+				FWD(self).template AddComponent<MainType, Self>(new MainType(), facilities);
 		}
 
 		/**
@@ -447,11 +832,12 @@ namespace Mcro::Composition
 		template <typename... ValidAs>
 		void AddAlias()
 		{
-			ASSERT_CRASH(LastAddedComponentHash != 0 && Components.Contains(LastAddedComponentHash),
+			ASSERT_CRASH(LastAddedComponentHash != 0 && HasExactComponent(LastAddedComponentHash),
 				->WithMessage(TEXT_"Component aliases were listed, but no components were added before.")
 				->WithDetails(TEXT_"Make sure `AddAlias` or `WithAlias` is called after `AddComponent` / `With`.")
 			);
 			(AddComponentAlias<ValidAs>(LastAddedComponentHash), ...);
+			NotifyRegistry();
 		}
 
 		/**
@@ -894,7 +1280,8 @@ namespace Mcro::Composition
 		 *	@return
 		 *	A range-view containing all the matched components. Components are provided as pointers to ensure they're
 		 *	not copied even under intricate object plumbing situations, but invalid pointers are never returned.
-		 *	(as long as the composable class is alive of course)
+		 *	(as long as the composable class is alive of course) Components are never relocated by the composable class, so
+		 *	these pointers also stay valid when further components are added.
 		 */
 		template <typename T>
 		ranges::any_view<T*> GetComponents() const
@@ -909,8 +1296,9 @@ namespace Mcro::Composition
 		 *	@brief
 		 *	Get the first component matching~ or aliased by the given type.
 		 *
-		 *	The order of components are non-deterministic so this method only make sense when it is trivial that only
-		 *	one component will be available for that particular type.
+		 *	A component registered exactly with the given type is preferred and found without scanning aliases. Otherwise
+		 *	the order of aliased components are non-deterministic so this method only make sense when it is trivial that
+		 *	only one component will be available for that particular type.
 		 *	
 		 *	@tparam T  Desired component type.
 		 *	
@@ -920,15 +1308,16 @@ namespace Mcro::Composition
 		template <typename T>
 		const T* TryGet() const
 		{
-			return GetComponents<T>() | First(nullptr);
+			return QueryComponents<T>().First();
 		}
 
 		/**
 		 *	@brief
 		 *	Get the first component matching~ or aliased by the given type.
 		 *
-		 *	The order of components are non-deterministic so this method only make sense when it is trivial that only
-		 *	one component will be available for that particular type.
+		 *	A component registered exactly with the given type is preferred and found without scanning aliases. Otherwise
+		 *	the order of aliased components are non-deterministic so this method only make sense when it is trivial that
+		 *	only one component will be available for that particular type.
 		 *	
 		 *	@tparam T  Desired component type.
 		 *	
@@ -938,15 +1327,16 @@ namespace Mcro::Composition
 		template <typename T>
 		T* TryGet()
 		{
-			return GetComponents<T>() | First(nullptr);
+			return QueryComponents<T>().First();
 		}
 		
 		/**
 		 *	@brief
 		 *	Get the first component matching~ or aliased by the given type.
 		 *
-		 *	The order of components are non-deterministic so this method only make sense when it is trivial that only
-		 *	one component will be available for that particular type.
+		 *	A component registered exactly with the given type is preferred and found without scanning aliases. Otherwise
+		 *	the order of aliased components are non-deterministic so this method only make sense when it is trivial that
+		 *	only one component will be available for that particular type.
 		 *
 		 *	@warning
 		 *	If there may be the slightest doubt that the given component may not exist on this composable class, use
@@ -969,8 +1359,9 @@ namespace Mcro::Composition
 		 *	@brief
 		 *	Get the first component matching~ or aliased by the given type.
 		 *
-		 *	The order of components are non-deterministic so this method only make sense when it is trivial that only
-		 *	one component will be available for that particular type.
+		 *	A component registered exactly with the given type is preferred and found without scanning aliases. Otherwise
+		 *	the order of aliased components are non-deterministic so this method only make sense when it is trivial that
+		 *	only one component will be available for that particular type.
 		 *
 		 *	@warning
 		 *	If there may be the slightest doubt that the given component may not exist on this composable class, use
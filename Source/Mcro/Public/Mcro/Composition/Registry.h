@@ -0,0 +1,335 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#pragma once
+
+#include <utility>
+
+#include "CoreMinimal.h"
+#include "Containers/StaticArray.h"
+#include "Async/ParallelFor.h"
+#include "Mcro/Composition.h"
+
+#ifndef MCRO_COMPOSABLE_CHUNK_SIZE
+/** @brief The maximum number of composable classes processed together in one chunk by `FComposableRegistry` queries */
+#define MCRO_COMPOSABLE_CHUNK_SIZE 64
+#endif
+
+namespace Mcro::Composition
+{
+	/**
+	 *	@brief
+	 *	A group of composable classes registered to an `FComposableRegistry`, which have the exact same set of
+	 *	component types and aliases (their signature).
+	 */
+	struct MCRO_API FComposableArchetype
+	{
+		/** Sorted set of exact component and alias type-hashes, the members of this archetype can be queried with */
+		TArray<FTypeHash> Signature;
+
+		/** The composable classes with this exact signature */
+		TArray<IComposable*> Members;
+
+		/**
+		 *	Indices into the component table of each member, in rows of `Signature.Num()`, one for each type in the
+		 *	signature. When multiple components match a type, the exact component is preferred, otherwise the first
+		 *	aliased one is used (same as `IComposable::TryGet`).
+		 */
+		TArray<int32> ComponentIndices;
+
+		FORCEINLINE int32 Num() const { return Members.Num(); }
+
+		/** @brief Get the position of a type-hash in the signature of this archetype, or INDEX_NONE if it's not in it */
+		int32 FindColumn(FTypeHash typeHash) const;
+	};
+
+	/**
+	 *	@brief
+	 *	A chunk of composable classes matching a query of `FComposableRegistry`, with contiguous pointers to their
+	 *	queried components. Components at the same index of each column belong to the composable class at that index.
+	 *
+	 *	@tparam Components  The queried component types
+	 */
+	template <typename... Components>
+	struct TComposableChunk
+	{
+		/** The composable classes in this chunk */
+		TArrayView<IComposable* const> Composables;
+
+		/** Pointers to components, one contiguous column for each queried component type. These are never null. */
+		TTuple<TArrayView<Components* const>...> Columns;
+
+		FORCEINLINE int32 Num() const { return Composables.Num(); }
+
+		/** @brief Get the component pointers of the I-th queried component type */
+		template <int32 I>
+		FORCEINLINE auto Get() const { return Columns.template Get<I>(); }
+	};
+
+	/**
+	 *	@brief
+	 *	Indexes many composable classes by the set of their component types (archetypes), so systems can process all
+	 *	composable classes having a given set of components, without looking up components on each object one-by-one.
+	 *	Queries resolve which archetypes and which columns of them match only once, until a new archetype is made.
+	 *
+	 *	Registered composable classes notify their registry when components or aliases are added to them, and when
+	 *	they're destroyed. Copies of registered composable classes are not registered automatically, but move
+	 *	constructing a registered composable class hands its registration over to the new object.
+	 *
+	 *	Usage:
+	 *	@code
+	 *	FComposableRegistry registry;
+	 *	for (auto& agent : Agents) registry.Register(*agent);
+	 *
+	 *	// in a tick
+	 *	registry.ParallelForEach<FTransformComponent, const FVelocityComponent>([](
+	 *		IComposable& agent,
+	 *		FTransformComponent& transform,
+	 *		FVelocityComponent const& velocity
+	 *	) {
+	 *		transform.Location += velocity.Value * DeltaTime;
+	 *	});
+	 *	@endcode
+	 *
+	 *	Querying a component type mutably (without `const`) clones the matched components if they're shared in
+	 *	copy-on-write mode, same as the non-const accessors of `IComposable`.
+	 *
+	 *	@warning
+	 *	Registered composable classes must stay at the same address while they're registered (for example heap
+	 *	allocated), unless they're moved via their move constructor. Unreal containers relocate their elements
+	 *	bitwise without running move constructors, so don't register composable classes stored directly in a `TArray`
+	 *	which may grow. The registry itself is not thread-safe. Composable classes
+	 *	must not gain components, nor be registered or destroyed while a query is running, even in parallel queries.
+	 */
+	class MCRO_API FComposableRegistry
+	{
+	public:
+		FComposableRegistry() = default;
+		~FComposableRegistry();
+
+		FComposableRegistry(FComposableRegistry const&) = delete;
+		FComposableRegistry& operator = (FComposableRegistry const&) = delete;
+
+		/**
+		 *	@brief
+		 *	Start indexing a composable class. If it was registered to another registry, it's removed from that one
+		 *	first. Registering a composable class again only refreshes its archetype.
+		 */
+		void Register(IComposable& composable);
+
+		/** @brief Stop indexing a composable class. It's safe to call with composable classes not registered here. */
+		void Unregister(IComposable& composable);
+
+		/**
+		 *	@brief
+		 *	Hand the registration of a composable class over to another one with the same components, typically the
+		 *	target of a move. `from` is not registered anymore afterwards. This is done automatically when a registered
+		 *	composable class is move constructed.
+		 */
+		void Relink(IComposable& from, IComposable& to);
+
+		/**
+		 *	@brief
+		 *	Refresh the archetype of a registered composable class. This is done automatically when components or
+		 *	aliases are added via the `IComposable` API.
+		 */
+		void Update(IComposable& composable);
+
+		/** @brief Is the given composable class indexed by this registry */
+		bool IsRegistered(IComposable const& composable) const;
+
+		/** @brief The number of registered composable classes */
+		int32 Num() const;
+
+		FORCEINLINE int32 NumArchetypes() const { return Archetypes.Num(); }
+		FORCEINLINE FComposableArchetype const& GetArchetype(int32 index) const { return Archetypes[index]; }
+
+		/**
+		 *	@brief
+		 *	Call a function with chunks of composable classes which have all the given component types, with
+		 *	contiguous pointers to the matched components. See `TComposableChunk`.
+		 *
+		 *	@tparam Components  Component types, either exact types or aliases
+		 *	@param    function  `void(TComposableChunk<Components...> const&)`
+		 */
+		template <typename... Components, typename Function>
+		requires (sizeof...(Components) > 0)
+		void ForEachChunk(Function&& function)
+		{
+			const FTypeHash required[] = { TTypeHash<std::decay_t<Components>>... };
+			FQuery const& query = FindQuery(required);
+
+			for (int32 i = 0; i < query.Archetypes.Num(); ++i)
+			{
+				FComposableArchetype& archetype = Archetypes[query.Archetypes[i]];
+				const int32* columns = query.Columns.GetData() + i * UE_ARRAY_COUNT(required);
+
+				for (int32 first = 0; first < archetype.Num(); first += MCRO_COMPOSABLE_CHUNK_SIZE)
+				{
+					const int32 count = FMath::Min(archetype.Num() - first, MCRO_COMPOSABLE_CHUNK_SIZE);
+					ProcessChunk<Components...>(archetype, columns, first, count, function);
+				}
+			}
+		}
+
+		/**
+		 *	@brief
+		 *	Call a function with each composable class which have all the given component types.
+		 *
+		 *	@tparam Components  Component types, either exact types or aliases
+		 *	@param    function  `void(IComposable&, Components&...)`
+		 */
+		template <typename... Components, typename Function>
+		requires (sizeof...(Components) > 0)
+		void ForEach(Function&& function)
+		{
+			ForEachChunk<Components...>([&](TComposableChunk<Components...> const& chunk)
+			{
+				ForEachInChunk(chunk, function);
+			});
+		}
+
+		/**
+		 *	@brief
+		 *	Same as `ForEachChunk` but chunks are processed in parallel on the task graph. This function returns when
+		 *	all chunks were processed.
+		 *
+		 *	@tparam Components  Component types, either exact types or aliases
+		 *	@param    function  `void(TComposableChunk<Components...> const&)`, called concurrently from worker threads.
+		 *	@param       flags  Flags passed on to `ParallelFor`
+		 */
+		template <typename... Components, typename Function>
+		requires (sizeof...(Components) > 0)
+		void ParallelForEachChunk(Function&& function, EParallelForFlags flags = EParallelForFlags::None)
+		{
+			const FTypeHash required[] = { TTypeHash<std::decay_t<Components>>... };
+			FQuery const& query = FindQuery(required);
+
+			TArray<FChunkRange, TInlineAllocator<64>> chunks;
+			for (int32 i = 0; i < query.Archetypes.Num(); ++i)
+			{
+				const int32 count = Archetypes[query.Archetypes[i]].Num();
+				for (int32 first = 0; first < count; first += MCRO_COMPOSABLE_CHUNK_SIZE)
+					chunks.Add({ i, first, FMath::Min(count - first, MCRO_COMPOSABLE_CHUNK_SIZE) });
+			}
+
+			ParallelFor(chunks.Num(), [&](int32 chunkIndex)
+			{
+				FChunkRange const& chunk = chunks[chunkIndex];
+				ProcessChunk<Components...>(
+					Archetypes[query.Archetypes[chunk.QueryArchetype]],
+					query.Columns.GetData() + chunk.QueryArchetype * UE_ARRAY_COUNT(required),
+					chunk.First, chunk.Count,
+					function
+				);
+			}, flags);
+		}
+
+		/**
+		 *	@brief
+		 *	Same as `ForEach` but composable classes are processed in parallel on the task graph, in chunks. This
+		 *	function returns when all composable classes were processed.
+		 *
+		 *	@tparam Components  Component types, either exact types or aliases
+		 *	@param    function  `void(IComposable&, Components&...)`, called concurrently from worker threads.
+		 *	@param       flags  Flags passed on to `ParallelFor`
+		 */
+		template <typename... Components, typename Function>
+		requires (sizeof...(Components) > 0)
+		void ParallelForEach(Function&& function, EParallelForFlags flags = EParallelForFlags::None)
+		{
+			ParallelForEachChunk<Components...>([&](TComposableChunk<Components...> const& chunk)
+			{
+				ForEachInChunk(chunk, function);
+			}, flags);
+		}
+
+	private:
+		struct FQuery
+		{
+			TArray<FTypeHash> Required;
+
+			/** Indices of the matching archetypes */
+			TArray<int32> Archetypes;
+
+			/** Signature columns of each matching archetype, in rows of `Required.Num()` */
+			TArray<int32> Columns;
+		};
+
+		struct FChunkRange
+		{
+			int32 QueryArchetype;
+			int32 First;
+			int32 Count;
+		};
+
+		TArray<FComposableArchetype> Archetypes;
+		/**
+		 *	Queries are stored behind pointers, so they're not invalidated by nested queries. Queries with colliding
+		 *	hashes are chained in the same bucket instead of replacing each other.
+		 */
+		TMap<FTypeHash, TArray<TUniquePtr<FQuery>, TInlineAllocator<1>>> Queries;
+
+		FQuery const& FindQuery(TArrayView<const FTypeHash> required);
+		int32 FindOrAddArchetype(TArrayView<const FTypeHash> signature);
+		void AddRow(IComposable& composable, int32 archetypeIndex, TArrayView<const int32> componentIndices);
+		void RemoveRow(IComposable& composable);
+
+		template <typename T>
+		static FORCEINLINE T* ResolveComponent(IComposable* composable, int32 componentIndex)
+		{
+			Detail::FComponentEntry& entry = composable->Components[componentIndex];
+			if constexpr (!std::is_const_v<T>)
+			{
+				if (composable->bCopyOnWrite) entry.Detach();
+			}
+			if constexpr (CSameAsDecayed<T, FAny>) return entry.Get();
+			else return entry.Get()->template TryGet<std::decay_t<T>>();
+		}
+
+		template <typename... Components, typename Function>
+		static void ProcessChunk(
+			FComposableArchetype& archetype,
+			const int32* columns,
+			int32 first, int32 count,
+			Function& function
+		) {
+			[&] <size_t... I> (std::index_sequence<I...>)
+			{
+				TTuple<TStaticArray<Components*, MCRO_COMPOSABLE_CHUNK_SIZE>...> pointers;
+				IComposable* const* members = archetype.Members.GetData() + first;
+				const int32 stride = archetype.Signature.Num();
+
+				for (int32 row = 0; row < count; ++row)
+				{
+					const int32* indices = archetype.ComponentIndices.GetData() + (first + row) * stride;
+					((pointers.template Get<I>()[row] = ResolveComponent<Components>(members[row], indices[columns[I]])), ...);
+				}
+
+				const TComposableChunk<Components...> chunk {
+					.Composables = TArrayView<IComposable* const>(members, count),
+					.Columns = MakeTuple(TArrayView<Components* const>(pointers.template Get<I>().GetData(), count)...)
+				};
+				function(chunk);
+			}(std::index_sequence_for<Components...>());
+		}
+
+		template <typename... Components, typename Function>
+		static void ForEachInChunk(TComposableChunk<Components...> const& chunk, Function& function)
+		{
+			[&] <size_t... I> (std::index_sequence<I...>)
+			{
+				for (int32 row = 0; row < chunk.Num(); ++row)
+					function(*chunk.Composables[row], *chunk.Columns.template Get<I>()[row]...);
+			}(std::index_sequence_for<Components...>());
+		}
+	};
+}
@@ -0,0 +1,255 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Mcro/Composition.h"
+
+namespace Mcro::Composition
+{
+	namespace Detail
+	{
+		template <typename T, typename... Components>
+		consteval int32 GetStaticComponentIndex()
+		{
+			int32 result = INDEX_NONE;
+			int32 index = 0;
+			auto findExact = [&] <typename Component> ()
+			{
+				if (result == INDEX_NONE && CSameAsDecayed<T, Component>) result = index;
+				++index;
+			};
+			(findExact.template operator()<Components>(), ...);
+			if (result != INDEX_NONE) return result;
+
+			index = 0;
+			auto findAliased = [&] <typename Component> ()
+			{
+				if (result == INDEX_NONE && CDerivedFrom<Component, T>) result = index;
+				++index;
+			};
+			(findAliased.template operator()<Components>(), ...);
+			return result;
+		}
+	}
+
+	template <CTypeList ComponentList, typename Self = void>
+	class TStaticComposable;
+
+	/**
+	 *	@brief
+	 *	A sibling of `IComposable` for classes which know their full set of components at declaration. Components are
+	 *	stored in a tuple as direct members, and `Get<T>()` is resolved at compile time, so accessing them costs the
+	 *	same as accessing any other member.
+	 *
+	 *	Components can be accessed via their exact type or via any of their base classes, including bases listed via
+	 *	`TInherit`. As the layout is known at compile time, aliases don't need to be registered explicitly. When
+	 *	multiple components match a type, the exact match is preferred, then the first matching component in
+	 *	declaration order. Use `ForEachComponent<T>` to visit all of them.
+	 *
+	 *	Explicit components (`IComponent` / `IStrictComponent`) receive the same `OnCreatedAt`, `OnCopiedAt` and
+	 *	`OnMovedAt` notifications as with `IComposable`, and `CCompatibleComponent` is enforced on all components.
+	 *	
+	 *	Usage:
+	 *	@code
+	 *	class FMyStaticType : public TStaticComposable<TTypes<FSimpleComponent, FComponentImplementation>> {};
+	 *
+	 *	FMyStaticType myStuff;
+	 *	int a = myStuff.Get<FSimpleComponent>().A;
+	 *	int b = myStuff.Get<IBaseComponent>().B;   // <- via the TInherit base of FComponentImplementation
+	 *	FVector* v = myStuff.TryGet<FVector>();   // <- nullptr, known at compile time
+	 *	// myStuff.Get<FVector>();                // <- compile error
+	 *	@endcode
+	 *
+	 *	Components receive this class as their parent by default. If they expect the derived class instead, pass it
+	 *	as the second template argument (CRTP):
+	 *	@code
+	 *	class FExpectedParent : public TStaticComposable<TTypes<FStrictComponent>, FExpectedParent> {};
+	 *	@endcode
+	 *	
+	 *	@warning
+	 *	Component notifications are executed from the constructor of `TStaticComposable` in which case the derived
+	 *	class is not constructed yet. Components should only store references to their parents in `OnCreatedAt`,
+	 *	`OnCopiedAt` or `OnMovedAt`.
+	 *
+	 *	@tparam Components  The list of component types (as `TTypes<...>`)
+	 *	@tparam       Self  Optionally the deriving class for passing it to component notifications
+	 */
+	template <typename... Components, typename Self>
+	class TStaticComposable<TTypes<Components...>, Self>
+	{
+	public:
+		using ComponentTypes = TTypes<Components...>;
+		using ParentType = std::conditional_t<std::is_void_v<Self>, TStaticComposable, Self>;
+
+		/** @brief Index of the component returned by `Get<T>()` or `INDEX_NONE` if none of the components match */
+		template <typename T>
+		static constexpr int32 ComponentIndex = Detail::GetStaticComponentIndex<T, Components...>();
+
+		/** @brief Does this composable class have a component matching~ or derived from given type */
+		template <typename T>
+		static constexpr bool HasComponent = ComponentIndex<T> != INDEX_NONE;
+		
+		TStaticComposable()
+		{
+			ForEachIndex([this] <size_t I> ()
+			{
+				using Component = TTypes_GetDecay<ComponentTypes, I>;
+				static_assert(CCompatibleComponent<Component, ParentType&>,
+					"A strict component is not compatible with this composable class"
+				);
+				if constexpr (CCompatibleExplicitComponent<Component, ParentType&>)
+					Storage.template Get<I>().OnCreatedAt(GetParent());
+			});
+		}
+		
+		TStaticComposable(TStaticComposable const& other)
+			: Storage(other.Storage)
+		{
+			NotifyCopied(other);
+		}
+		
+		TStaticComposable(TStaticComposable&& other) noexcept
+			: Storage(MoveTemp(other.Storage))
+		{
+			NotifyMoved();
+		}
+
+		TStaticComposable& operator = (TStaticComposable const& other)
+		{
+			if (this == &other) return *this;
+			Storage = other.Storage;
+			NotifyCopied(other);
+			return *this;
+		}
+		
+		TStaticComposable& operator = (TStaticComposable&& other) noexcept
+		{
+			if (this == &other) return *this;
+			Storage = MoveTemp(other.Storage);
+			NotifyMoved();
+			return *this;
+		}
+
+		/**
+		 *	@brief  Get the component matching~ or derived from the given type. It's a compile error if there's none.
+		 *	@tparam T  Desired component type.
+		 */
+		template <typename T>
+		requires HasComponent<T>
+		FORCEINLINE T& Get()
+		{
+			return Storage.template Get<ComponentIndex<T>>();
+		}
+
+		/**
+		 *	@brief  Get the component matching~ or derived from the given type. It's a compile error if there's none.
+		 *	@tparam T  Desired component type.
+		 */
+		template <typename T>
+		requires HasComponent<T>
+		FORCEINLINE T const& Get() const
+		{
+			return Storage.template Get<ComponentIndex<T>>();
+		}
+
+		/**
+		 *	@brief  Get the component matching~ or derived from the given type if there's one.
+		 *	@tparam T  Desired component type.
+		 *	@return A pointer to the component or nullptr, which is decided at compile time.
+		 */
+		template <typename T>
+		FORCEINLINE T* TryGet()
+		{
+			if constexpr (HasComponent<T>) return &Get<T>();
+			else return nullptr;
+		}
+
+		/**
+		 *	@brief  Get the component matching~ or derived from the given type if there's one.
+		 *	@tparam T  Desired component type.
+		 *	@return A pointer to the component or nullptr, which is decided at compile time.
+		 */
+		template <typename T>
+		FORCEINLINE const T* TryGet() const
+		{
+			if constexpr (HasComponent<T>) return &Get<T>();
+			else return nullptr;
+		}
+
+		/**
+		 *	@brief  Visit all components matching~ or derived from the given type, in declaration order.
+		 *	@tparam T  Desired component type.
+		 *	@param  function  Called with a reference of each matching component as `T&`
+		 */
+		template <typename T, typename Function>
+		void ForEachComponent(Function&& function)
+		{
+			ForEachIndex([&, this] <size_t I> ()
+			{
+				using Component = TTypes_GetDecay<ComponentTypes, I>;
+				if constexpr (CSameAsDecayed<T, Component> || CDerivedFrom<Component, T>)
+					function(static_cast<T&>(Storage.template Get<I>()));
+			});
+		}
+
+		/**
+		 *	@brief  Visit all components matching~ or derived from the given type, in declaration order.
+		 *	@tparam T  Desired component type.
+		 *	@param  function  Called with a const reference of each matching component as `T const&`
+		 */
+		template <typename T, typename Function>
+		void ForEachComponent(Function&& function) const
+		{
+			ForEachIndex([&, this] <size_t I> ()
+			{
+				using Component = TTypes_GetDecay<ComponentTypes, I>;
+				if constexpr (CSameAsDecayed<T, Component> || CDerivedFrom<Component, T>)
+					function(static_cast<T const&>(Storage.template Get<I>()));
+			});
+		}
+
+	private:
+		template <typename Function>
+		static void ForEachIndex(Function&& function)
+		{
+			[&] <size_t... Indices> (std::index_sequence<Indices...>&&)
+			{
+				(function.template operator()<Indices>(), ...);
+			}(std::index_sequence_for<Components...>());
+		}
+		
+		FORCEINLINE ParentType& GetParent() { return static_cast<ParentType&>(*this); }
+
+		void NotifyCopied(TStaticComposable const& other)
+		{
+			ForEachIndex([&, this] <size_t I> ()
+			{
+				using Component = TTypes_GetDecay<ComponentTypes, I>;
+				if constexpr (CCopyAwareComponent<Component, ParentType&>)
+					Storage.template Get<I>().OnCopiedAt(GetParent(), other.Storage.template Get<I>());
+			});
+		}
+
+		void NotifyMoved()
+		{
+			ForEachIndex([this] <size_t I> ()
+			{
+				using Component = TTypes_GetDecay<ComponentTypes, I>;
+				if constexpr (CMoveAwareComponent<Component, ParentType&>)
+					Storage.template Get<I>().OnMovedAt(GetParent());
+			});
+		}
+		
+		TTuple<Components...> Storage;
+	};
+}
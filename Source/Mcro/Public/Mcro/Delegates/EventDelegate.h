@@ -11,9 +11,14 @@
 
 #pragma once
 
+#include <atomic>
+
 #include "CoreMinimal.h"
+#include "Algo/Count.h"
+#include "Async/ParallelFor.h"
 #include "Mcro/FunctionTraits.h"
 #include "Mcro/InitializeOnCopy.h"
+#include "Mcro/TextMacros.h"
 #include "Mcro/Delegates/AsNative.h"
 #include "Mcro/Delegates/DelegateFrom.h"
 
@@ -41,23 +46,67 @@ namespace Mcro::Delegates
 		/** @brief Enable mutex locks around adding/broadcasting delegates. Only considered in DefaultPolicy */
 		bool ThreadSafe = false;
 
+		/**
+		 *	@brief
+		 *	Thread-safe mode where listeners are stored in an immutable list, which is replaced by a modified copy
+		 *	when listeners are added or removed. Broadcasts iterate the list they've acquired without holding a lock,
+		 *	so broadcasters don't block each-other, nor do they block adding or removing listeners while listeners
+		 *	are running. Only considered in DefaultPolicy, and it implies `ThreadSafe`.
+		 *
+		 *	Listeners removed during a concurrent broadcast may still be called by that broadcast. `Once` listeners
+		 *	are still called only once, even with concurrent broadcasts.
+		 *
+		 *	The mutex of the event is only taken for updating the argument cache and removing fired `Once` listeners,
+		 *	and not at all with `NoArgumentCache`, unless `Once` listeners were fired. Belated listeners are called
+		 *	with a copy of the cached arguments after the mutex is released.
+		 *
+		 *	@warning
+		 *	The argument cache is filled on every broadcast under the mutex, so concurrent broadcasters still serialize
+		 *	on that. Combine it with `NoArgumentCache` for events which are broadcast from many threads at once.
+		 */
+		bool LockFreeBroadcast = false;
+
+		/**
+		 *	@brief
+		 *	Don't store the arguments of broadcasts at all, so broadcasting never copies them. `Belated` bindings are
+		 *	not supported then. Use it for events which never need belated bindings, especially with large payloads.
+		 *	Only considered in DefaultPolicy.
+		 */
+		bool NoArgumentCache = false;
+
+		/**
+		 *	@brief
+		 *	Store up to this many listeners inline, in the event delegate itself, instead of in a heap allocated
+		 *	`TMulticastDelegate`, and dispatch them in a simple loop. Events with few listeners don't allocate for
+		 *	their listener list then (delegate instances themselves still follow the allocation settings of Unreal
+		 *	delegates). Zero disables inline storage. Only considered in DefaultPolicy, and it's ignored with
+		 *	`LockFreeBroadcast`.
+		 */
+		int32 InlineListeners = 0;
+
 		/** @brief Merge two policy flags */
 		FORCEINLINE constexpr FEventPolicy With(FEventPolicy const& other) const
 		{
 			return {
 				Once         || other.Once,
 				Belated      || other.Belated,
-				CacheViaCopy || other.CacheViaCopy,
-				ThreadSafe   || other.ThreadSafe
+				CacheViaCopy      || other.CacheViaCopy,
+				ThreadSafe        || other.ThreadSafe,
+				LockFreeBroadcast || other.LockFreeBroadcast,
+				NoArgumentCache   || other.NoArgumentCache,
+				InlineListeners > other.InlineListeners ? InlineListeners : other.InlineListeners
 			};
 		}
 
 		FORCEINLINE friend constexpr bool operator == (FEventPolicy const& lhs, FEventPolicy const& rhs)
 		{
-			return lhs.Once         == rhs.Once
-				&& lhs.Belated      == rhs.Belated
-				&& lhs.CacheViaCopy == rhs.CacheViaCopy
-				&& lhs.ThreadSafe   == rhs.ThreadSafe
+			return lhs.Once              == rhs.Once
+				&& lhs.Belated           == rhs.Belated
+				&& lhs.CacheViaCopy      == rhs.CacheViaCopy
+				&& lhs.ThreadSafe        == rhs.ThreadSafe
+				&& lhs.LockFreeBroadcast == rhs.LockFreeBroadcast
+				&& lhs.NoArgumentCache   == rhs.NoArgumentCache
+				&& lhs.InlineListeners   == rhs.InlineListeners
 			;
 		}
 
@@ -73,6 +122,293 @@ namespace Mcro::Delegates
 		}
 	};
 
+	namespace Detail
+	{
+		/** Whether a `TEventDelegate` was broadcasted, it can be set and read from any thread without locking */
+		class FBroadcastedFlag
+		{
+		public:
+			FBroadcastedFlag() = default;
+			FBroadcastedFlag(FBroadcastedFlag const& other) : Value(other.Get()) {}
+			FBroadcastedFlag& operator = (FBroadcastedFlag const& other)
+			{
+				Value.store(other.Get(), std::memory_order_release);
+				return *this;
+			}
+			FBroadcastedFlag& operator = (bool value)
+			{
+				Value.store(value, std::memory_order_release);
+				return *this;
+			}
+
+			FORCEINLINE bool Get() const { return Value.load(std::memory_order_acquire); }
+			FORCEINLINE operator bool () const { return Get(); }
+
+		private:
+			std::atomic<bool> Value { false };
+		};
+
+		/**
+		 *	Listener storage of `TEventDelegate` with `LockFreeBroadcast` policy. The list of listeners is an immutable
+		 *	reference counted snapshot, modifications publish a modified copy of it. Acquiring the snapshot only takes
+		 *	a read lock for copying a shared reference, listeners are executed without any locks.
+		 *
+		 *	Modifications must be serialized by the owner (`TEventDelegate` does that with its own mutex).
+		 */
+		template <typename... Args>
+		class TSnapshotListeners
+		{
+		public:
+			using FDelegate = TDelegate<void(Args...), FDefaultDelegateUserPolicy>;
+
+			struct FListener
+			{
+				FListener(FDelegate const& delegate, bool once)
+					: Delegate(delegate)
+					, Handle(FDelegateHandle::GenerateNewHandle)
+					, bOnce(once)
+				{}
+
+				FDelegate Delegate;
+				FDelegateHandle Handle;
+				bool bOnce;
+				mutable std::atomic<bool> bFired { false };
+			};
+
+			using FListenerRef = TSharedRef<const FListener, ESPMode::ThreadSafe>;
+			using FList = TArray<FListenerRef>;
+			using FSnapshot = TSharedRef<const FList, ESPMode::ThreadSafe>;
+
+			/** Get the current listeners, the returned list is never modified */
+			FSnapshot GetSnapshot() const
+			{
+				FReadScopeLock lock(SnapshotLock.Get());
+				return Snapshot;
+			}
+
+			FDelegateHandle Add(FDelegate const& delegate, bool once)
+			{
+				FListenerRef listener = MakeShared<FListener, ESPMode::ThreadSafe>(delegate, once);
+				FList next(*Snapshot);
+				next.Add(listener);
+				Publish(MoveTemp(next));
+				return listener->Handle;
+			}
+
+			bool Remove(FDelegateHandle const& handle)
+			{
+				return Modify([&](FListener const& listener) { return listener.Handle == handle; }) > 0;
+			}
+
+			int32 RemoveAll(const void* object)
+			{
+				return Modify([&](FListener const& listener)
+				{
+					return listener.Delegate.IsBoundToObject(object);
+				});
+			}
+
+			bool IsBound() const { return !GetSnapshot()->IsEmpty(); }
+
+			void Clear() { Publish({}); }
+
+			/**
+			 *	Execute the listeners of the current snapshot.
+			 *	@return  Handles of `Once` listeners which were executed by this broadcast, which should be removed.
+			 */
+			TArray<FDelegateHandle, TInlineAllocator<4>> Broadcast(Args... args) const
+			{
+				TArray<FDelegateHandle, TInlineAllocator<4>> fired;
+				const FSnapshot snapshot = GetSnapshot();
+				for (FListenerRef const& listener : *snapshot)
+				{
+					if (listener->bOnce)
+					{
+						if (listener->bFired.exchange(true)) continue;
+						fired.Add(listener->Handle);
+					}
+					listener->Delegate.ExecuteIfBound(args...);
+				}
+				return fired;
+			}
+
+			/**
+			 *	Execute the listeners of the current snapshot concurrently, and wait for all of them to finish.
+			 *	@return  Handles of `Once` listeners which were executed by this broadcast, which should be removed.
+			 */
+			TArray<FDelegateHandle, TInlineAllocator<4>> BroadcastParallel(Args... args) const
+			{
+				const FSnapshot snapshot = GetSnapshot();
+				TArray<bool, TInlineAllocator<16>> firedHere;
+				firedHere.SetNumZeroed(snapshot->Num());
+
+				// Arguments are shared by reference across tasks, ParallelFor joins before they go out of scope
+				ParallelFor(snapshot->Num(), [&](int32 i)
+				{
+					FListener const& listener = *(*snapshot)[i];
+					if (listener.bOnce)
+					{
+						if (listener.bFired.exchange(true)) return;
+						firedHere[i] = true;
+					}
+					listener.Delegate.ExecuteIfBound(args...);
+				});
+
+				TArray<FDelegateHandle, TInlineAllocator<4>> fired;
+				for (int32 i = 0; i < firedHere.Num(); ++i)
+					if (firedHere[i]) fired.Add((*snapshot)[i]->Handle);
+				return fired;
+			}
+
+		private:
+			template <typename Predicate>
+			int32 Modify(Predicate&& shouldRemove)
+			{
+				const int32 count = Algo::CountIf(*Snapshot, [&](FListenerRef const& listener)
+				{
+					return shouldRemove(*listener);
+				});
+				if (count == 0) return 0;
+
+				FList next;
+				next.Reserve(Snapshot->Num() - count);
+				for (FListenerRef const& listener : *Snapshot)
+					if (!shouldRemove(*listener)) next.Add(listener);
+
+				Publish(MoveTemp(next));
+				return count;
+			}
+
+			void Publish(FList&& next)
+			{
+				FSnapshot published = MakeShared<FList, ESPMode::ThreadSafe>(MoveTemp(next));
+				FWriteScopeLock lock(SnapshotLock.Get());
+				Snapshot = MoveTemp(published);
+			}
+
+			FSnapshot Snapshot = MakeShared<FList, ESPMode::ThreadSafe>();
+			mutable TInitializeOnCopy<FRWLock> SnapshotLock;
+		};
+	}
+
+	namespace Detail
+	{
+		/**
+		 *	Listener storage of `TEventDelegate` with `InlineListeners` policy. Listeners are stored in an array with
+		 *	inline capacity. Listeners removed during a broadcast are only unbound, and they're compacted when the
+		 *	outermost broadcast has finished. Listeners added during a broadcast are not executed by it.
+		 *
+		 *	Listeners are executed in the same order as `TMulticastDelegate` would, from the last added one to the
+		 *	first one, so states switching to inline storage keep their notification order.
+		 *
+		 *	This storage is not thread-safe, `TEventDelegate` guards it with its own mutex when needed.
+		 */
+		template <int32 InlineCount, typename... Args>
+		class TInlineListeners
+		{
+		public:
+			using FDelegate = TDelegate<void(Args...), FDefaultDelegateUserPolicy>;
+
+			FDelegateHandle Add(FDelegate const& delegate, bool once)
+			{
+				FListener& listener = Listeners.Emplace_GetRef();
+				listener.Delegate = delegate;
+				listener.Handle = FDelegateHandle(FDelegateHandle::GenerateNewHandle);
+				listener.bOnce = once;
+				return listener.Handle;
+			}
+
+			bool Remove(FDelegateHandle const& handle)
+			{
+				return RemoveWhere([&](FListener const& listener) { return listener.Handle == handle; }) > 0;
+			}
+
+			int32 RemoveAll(const void* object)
+			{
+				return RemoveWhere([&](FListener const& listener)
+				{
+					return listener.Delegate.IsBoundToObject(object);
+				});
+			}
+
+			bool IsBound() const
+			{
+				for (FListener const& listener : Listeners)
+					if (listener.Delegate.IsBound()) return true;
+				return false;
+			}
+
+			void Clear()
+			{
+				RemoveWhere([](FListener const&) { return true; });
+			}
+
+			/**
+			 *	Execute the listeners added before this broadcast.
+			 *	@return  Handles of `Once` listeners which were executed by this broadcast.
+			 */
+			TArray<FDelegateHandle, TInlineAllocator<InlineCount>> Broadcast(Args... args)
+			{
+				TArray<FDelegateHandle, TInlineAllocator<InlineCount>> fired;
+				++BroadcastDepth;
+
+				// Listeners may be added or removed by the executed delegates, so they're accessed by index. New
+				// listeners are appended, so iterating backwards from the current last one skips them.
+				for (int32 i = Listeners.Num() - 1; i >= 0; --i)
+				{
+					if (!Listeners[i].Delegate.IsBound()) continue;
+					if (Listeners[i].bOnce)
+					{
+						// Unbind before executing, so nested broadcasts don't execute it again
+						FDelegate once = MoveTemp(Listeners[i].Delegate);
+						Listeners[i].Delegate.Unbind();
+						bNeedsCompaction = true;
+						fired.Add(Listeners[i].Handle);
+						once.ExecuteIfBound(args...);
+					}
+					else Listeners[i].Delegate.ExecuteIfBound(args...);
+				}
+
+				if (--BroadcastDepth == 0) Compact();
+				return fired;
+			}
+
+		private:
+			struct FListener
+			{
+				FDelegate Delegate;
+				FDelegateHandle Handle;
+				bool bOnce = false;
+			};
+
+			template <typename Predicate>
+			int32 RemoveWhere(Predicate&& predicate)
+			{
+				int32 removed = 0;
+				for (FListener& listener : Listeners)
+				{
+					if (!predicate(listener)) continue;
+					if (listener.Delegate.IsBound()) ++removed;
+					listener.Delegate.Unbind();
+					bNeedsCompaction = true;
+				}
+				if (BroadcastDepth == 0) Compact();
+				return removed;
+			}
+
+			void Compact()
+			{
+				if (!bNeedsCompaction) return;
+				bNeedsCompaction = false;
+				Listeners.RemoveAll([](FListener const& listener) { return !listener.Delegate.IsBound(); });
+			}
+
+			TArray<FListener, TInlineAllocator<InlineCount>> Listeners;
+			int32 BroadcastDepth = 0;
+			bool bNeedsCompaction = false;
+		};
+	}
+
 	/**
 	 *	@brief
 	 *	"Extension" of a common TMulticastDelegate. It allows to define optional "flags" when adding a binding,
@@ -106,7 +442,8 @@ namespace Mcro::Delegates
 	class TEventDelegate<void(Args...), DefaultPolicy>
 	{
 	public:
-		using MutexLock = std::conditional_t<DefaultPolicy.ThreadSafe, FScopeLock, FVoid>;
+		static constexpr bool bThreadSafe = DefaultPolicy.ThreadSafe || DefaultPolicy.LockFreeBroadcast;
+		using MutexLock = std::conditional_t<bThreadSafe, FScopeLock, FVoid>;
 		
 		using FunctionSignature = void(Args...);
 		using FDelegate = TDelegate<FunctionSignature, FDefaultDelegateUserPolicy>;
@@ -116,29 +453,111 @@ namespace Mcro::Delegates
 			TTuple<std::decay_t<Args>...>,
 			TTuple<Args...>
 		>;
+
+		static_assert(!(DefaultPolicy.NoArgumentCache && DefaultPolicy.Belated),
+			"Belated bindings need the arguments of the last broadcast, they cannot be used with NoArgumentCache policy."
+		);
 		
+		/**
+		 *	@brief  Execute all listeners with the given arguments.
+		 *
+		 *	The arguments are stored for belated bindings, unless `NoArgumentCache` policy is set. With `CacheViaCopy`
+		 *	policy they're copied into the cache in-place, or when all of them are passed as r-values, they're moved
+		 *	into the cache after all listeners were executed, without any copies. In the latter case belated bindings
+		 *	added by the listeners of this broadcast are called only once the cache is filled with these arguments.
+		 */
 		template <typename... BroadcastArgs>
 		requires CConvertibleTo<TTuple<BroadcastArgs...>, TTuple<Args...>>
 		void Broadcast(BroadcastArgs&&... args)
 		{
-			MutexLock lock(&Mutex.Get());
-			bHasBroadcasted = true;
-			if constexpr (DefaultPolicy.CacheViaCopy)
+			constexpr bool moveIntoCache = DefaultPolicy.CacheViaCopy
+				&& !DefaultPolicy.NoArgumentCache
+				&& (!std::is_lvalue_reference_v<BroadcastArgs> && ...);
+			
+			if constexpr (DefaultPolicy.LockFreeBroadcast)
 			{
-				// this here actually copies twice, instead of once, but if we don't have this temporary variable
-				// it doesn't copy at all. CopyTemp, or function with pass-by-copy parameters didn't help
-				ArgumentsCache cache{args...};
-				Cache = cache;
+				// Without an argument cache the mutex is only taken when Once listeners need to be removed
+				if constexpr (!DefaultPolicy.NoArgumentCache)
+				{
+					MutexLock lock(&Mutex.Get());
+					if constexpr (moveIntoCache) BeginCacheFill();
+					else CacheArguments(args...);
+
+					// Belated bindings added concurrently must find the cache filled (or pending) once they see this
+					bHasBroadcasted = true;
+				}
+				else bHasBroadcasted = true;
+				
+				auto fired = MulticastDelegate.Broadcast(args...);
+				FBelatedCalls belated;
+				if (moveIntoCache || !fired.IsEmpty())
+				{
+					MutexLock lock(&Mutex.Get());
+					if constexpr (moveIntoCache)
+					{
+						CacheArguments(MoveTemp(args)...);
+						EndCacheFill(belated);
+					}
+					for (const FDelegateHandle& handle : fired)
+						RemoveInternal(handle);
+				}
+				belated.Execute();
 			}
 			else
-				Cache = ArgumentsCache(FWD(args)...);
-			
-			MulticastDelegate.Broadcast(FWD(args)...);
-		
-			for (const FDelegateHandle& handle : OnlyNextDelegates)
-				MulticastDelegate.Remove(handle);
+			{
+				MutexLock lock(&Mutex.Get());
+				bHasBroadcasted = true;
+				if constexpr (moveIntoCache)
+				{
+					// Belated calls are only deferred with LockFreeBroadcast, so this doesn't need executing
+					FBelatedCalls belated;
+					BeginCacheFill();
+					BroadcastListeners(args...);
+					CacheArguments(MoveTemp(args)...);
+					EndCacheFill(belated);
+				}
+				else
+				{
+					CacheArguments(args...);
+					BroadcastListeners(FWD(args)...);
+				}
+			}
+		}
+
+		/**
+		 *	@brief
+		 *	Execute all listeners concurrently on the task graph, and return only when all of them have finished.
+		 *	Use it for events with many heavy listeners which don't depend on each other. It's only available with
+		 *	`LockFreeBroadcast` policy, so listeners can add or remove bindings while others are still running.
+		 *
+		 *	- Listeners may run on any worker thread, and in any order, including the calling thread.
+		 *	- Arguments are passed to every listener as the same references, they must not be mutable references,
+		 *	  and they stay alive until this function returns.
+		 *	- `Once` listeners are executed only once (even with concurrent broadcasts), and they're removed after
+		 *	  every listener of this broadcast has finished.
+		 *	- Arguments are cached for belated bindings before listeners are executed.
+		 */
+		template <typename... BroadcastArgs>
+		requires (DefaultPolicy.LockFreeBroadcast)
+			&& CConvertibleTo<TTuple<BroadcastArgs...>, TTuple<Args...>>
+			&& (!(std::is_lvalue_reference_v<Args> && !std::is_const_v<std::remove_reference_t<Args>>) && ...)
+		void BroadcastParallel(BroadcastArgs&&... args)
+		{
+			if constexpr (!DefaultPolicy.NoArgumentCache)
+			{
+				MutexLock lock(&Mutex.Get());
+				CacheArguments(args...);
+				bHasBroadcasted = true;
+			}
+			else bHasBroadcasted = true;
 			
-			OnlyNextDelegates.Empty();
+			auto fired = MulticastDelegate.BroadcastParallel(args...);
+			if (!fired.IsEmpty())
+			{
+				MutexLock lock(&Mutex.Get());
+				for (const FDelegateHandle& handle : fired)
+					RemoveInternal(handle);
+			}
 		}
 
 		/**
@@ -170,8 +589,14 @@ namespace Mcro::Delegates
 		 */
 		FDelegateHandle Add(FDelegate delegate, FEventPolicy const& policy = {})
 		{
-			MutexLock lock(&Mutex.Get());
-			return AddInternal(delegate, policy);
+			FBelatedCalls belated;
+			FDelegateHandle handle;
+			{
+				MutexLock lock(&Mutex.Get());
+				handle = AddInternal(delegate, policy, belated);
+			}
+			belated.Execute();
+			return handle;
 		}
 		
 		/**
@@ -181,8 +606,12 @@ namespace Mcro::Delegates
 		template <CSameAs<FDelegate>... Delegates>
 		TEventDelegate& With(Delegates&&... delegates)
 		{
-			MutexLock lock(&Mutex.Get());
-			(AddInternal(delegates, {}), ...);
+			FBelatedCalls belated;
+			{
+				MutexLock lock(&Mutex.Get());
+				(AddInternal(delegates, {}, belated), ...);
+			}
+			belated.Execute();
 			return *this;
 		}
 
@@ -192,7 +621,9 @@ namespace Mcro::Delegates
 		template <CSameAs<FDelegate>... Delegates>
 		TEventDelegate(Delegates... delegates)
 		{
-			(AddInternal(delegates, {}), ...);
+			// Nothing is broadcasted yet, so there can't be any belated calls
+			FBelatedCalls belated;
+			(AddInternal(delegates, {}, belated), ...);
 		}
 
 		/**
@@ -209,8 +640,14 @@ namespace Mcro::Delegates
 		template <CDynamicDelegate DynamicDelegateType>
 		FDelegateHandle Add(const DynamicDelegateType& dynamicDelegate, FEventPolicy const& policy = {})
 		{
-			MutexLock lock(&Mutex.Get());
-			return AddInternal(AsNative(dynamicDelegate), policy, {}, dynamicDelegate.GetUObject(), dynamicDelegate.GetFunctionName());
+			FBelatedCalls belated;
+			FDelegateHandle handle;
+			{
+				MutexLock lock(&Mutex.Get());
+				handle = AddInternal(AsNative(dynamicDelegate), policy, belated, {}, dynamicDelegate.GetUObject(), dynamicDelegate.GetFunctionName());
+			}
+			belated.Execute();
+			return handle;
 		}
 
 		/**
@@ -229,11 +666,42 @@ namespace Mcro::Delegates
 		template <CDynamicDelegate DynamicDelegateType>
 		FDelegateHandle AddUnique(const DynamicDelegateType& dynamicDelegate, FEventPolicy const& policy = {})
 		{
-			MutexLock lock(&Mutex.Get());
-			return AddUniqueInternal(AsNative(dynamicDelegate), policy, dynamicDelegate.GetUObject(), dynamicDelegate.GetFunctionName());
+			FBelatedCalls belated;
+			FDelegateHandle handle;
+			{
+				MutexLock lock(&Mutex.Get());
+				handle = AddUniqueInternal(AsNative(dynamicDelegate), policy, belated, dynamicDelegate.GetUObject(), dynamicDelegate.GetFunctionName());
+			}
+			belated.Execute();
+			return handle;
 		}
 
 	private:
+		/**
+		 *	Belated listeners collected while the mutex is held. With `LockFreeBroadcast` policy they're executed
+		 *	after the mutex is released (with a copy of the cached arguments), so they can't block broadcasters or
+		 *	other threads adding listeners. Otherwise they're executed immediately when they're added.
+		 */
+		struct FBelatedCalls
+		{
+			static constexpr bool bDeferred = DefaultPolicy.LockFreeBroadcast
+				&& !DefaultPolicy.NoArgumentCache
+				&& std::is_copy_constructible_v<ArgumentsCache>;
+			
+			std::conditional_t<bDeferred, TArray<FDelegate, TInlineAllocator<1>>, FVoid> Delegates;
+			std::conditional_t<bDeferred, TOptional<ArgumentsCache>, FVoid> Arguments;
+
+			void Execute()
+			{
+				if constexpr (bDeferred)
+				{
+					if (!Arguments.IsSet()) return;
+					for (FDelegate& delegate : Delegates)
+						InvokeWithTuple(&delegate, &FDelegate::Execute, Arguments.GetValue());
+				}
+			}
+		};
+		
 		bool RemoveInternal(const FDelegateHandle& delegateHandle)
 		{
 			const bool result = MulticastDelegate.Remove(delegateHandle);
@@ -303,7 +771,11 @@ namespace Mcro::Delegates
 			OnlyNextDelegates.Reset();
 			BoundUFunctionsMap.Reset();
 			bHasBroadcasted = false;
-			Cache.Reset();
+			if constexpr (!DefaultPolicy.NoArgumentCache)
+			{
+				Cache.Reset();
+				PendingBelated.Reset();
+			}
 		}
 
 		/** @returns true if this event delegate was ever broadcasted. */
@@ -312,11 +784,70 @@ namespace Mcro::Delegates
 			return bHasBroadcasted;
 		}
 
+		/** @returns true if this event delegate has any listeners. */
+		bool IsBound() const
+		{
+			return MulticastDelegate.IsBound();
+		}
+
 	private:
 
+		template <typename... BroadcastArgs>
+		void BroadcastListeners(BroadcastArgs&&... args)
+		{
+			if constexpr (DefaultPolicy.InlineListeners > 0)
+			{
+				for (const FDelegateHandle& handle : MulticastDelegate.Broadcast(args...))
+					RemoveInternal(handle);
+			}
+			else
+			{
+				MulticastDelegate.Broadcast(FWD(args)...);
+			
+				for (const FDelegateHandle& handle : OnlyNextDelegates)
+					MulticastDelegate.Remove(handle);
+				
+				OnlyNextDelegates.Empty();
+			}
+		}
+
+		/**
+		 *	Arguments are moved into the cache only after the listeners have run, so until then belated bindings
+		 *	shouldn't see the arguments of the previous broadcast. They're queued instead, until `EndCacheFill`.
+		 */
+		void BeginCacheFill()
+		{
+			if constexpr (!DefaultPolicy.NoArgumentCache)
+			{
+				Cache.Reset();
+				++PendingCacheFills;
+			}
+		}
+
+		/** Call the belated bindings which were added while the cache was not filled yet */
+		void EndCacheFill(FBelatedCalls& belated)
+		{
+			if constexpr (!DefaultPolicy.NoArgumentCache)
+			{
+				--PendingCacheFills;
+				auto pending = MoveTemp(PendingBelated);
+				for (FDelegate& delegate : pending)
+					CallBelated(delegate, belated);
+			}
+		}
+
+		/** Construct the cached arguments in-place, so they're copied (or moved) only once */
+		template <typename... CacheArgs>
+		FORCEINLINE void CacheArguments(CacheArgs&&... args)
+		{
+			if constexpr (!DefaultPolicy.NoArgumentCache)
+				Cache.Emplace(FWD(args)...);
+		}
+
 		FDelegateHandle AddUniqueInternal(
 			FDelegate delegate,
 			FEventPolicy const& policy,
+			FBelatedCalls& belated,
 			const UObject* boundObject,
 			const FName& boundFunctionName
 		) {
@@ -325,12 +856,13 @@ namespace Mcro::Delegates
 			if (const FDelegateHandle* delegateHandle = BoundUFunctionsMap.Find(FBoundUFunction(boundObject, boundFunctionName)))
 				uniqueHandle = *delegateHandle;
 			
-			return AddInternal(delegate, policy, uniqueHandle, boundObject, boundFunctionName);
+			return AddInternal(delegate, policy, belated, uniqueHandle, boundObject, boundFunctionName);
 		}
 
 		FDelegateHandle AddInternal(
 			FDelegate delegate,
 			FEventPolicy const& policy,
+			FBelatedCalls& belated,
 			FDelegateHandle const& uniqueHandle = {}, 
 			const UObject* boundObject = nullptr,
 			FName const& boundFunctionName = NAME_None
@@ -339,44 +871,77 @@ namespace Mcro::Delegates
 
 			if (bHasBroadcasted && actualPolicy.Belated && actualPolicy.Once)
 			{
-				CallBelated(delegate);
+				CallBelated(delegate, belated);
 				return FDelegateHandle();
 			}
 			
 			FDelegateHandle outputHandle = uniqueHandle;
 			if (!outputHandle.IsValid())
 			{
-				outputHandle = MulticastDelegate.Add(delegate);
+				if constexpr (DefaultPolicy.LockFreeBroadcast || DefaultPolicy.InlineListeners > 0)
+					outputHandle = MulticastDelegate.Add(delegate, actualPolicy.Once);
+				else
+				{
+					outputHandle = MulticastDelegate.Add(delegate);
+					if (actualPolicy.Once)
+						OnlyNextDelegates.Add(outputHandle);
+				}
 
 				if (boundObject && boundFunctionName != NAME_None)
 					BoundUFunctionsMap.Add(FBoundUFunction(boundObject, boundFunctionName), outputHandle);
-
-				if (actualPolicy.Once)
-					OnlyNextDelegates.Add(outputHandle);
 			}
 
 			if (bHasBroadcasted && actualPolicy.Belated)
-				CallBelated(delegate);
+				CallBelated(delegate, belated);
 			
 			return outputHandle;
 		}
 
-		void CallBelated(FDelegate& delegate)
+		void CallBelated(FDelegate& delegate, FBelatedCalls& belated)
 		{
-			InvokeWithTuple(&delegate, &FDelegate::Execute, Cache.GetValue());
+			if constexpr (DefaultPolicy.NoArgumentCache)
+			{
+				ensureMsgf(false, TEXT_"Belated bindings are not supported with NoArgumentCache policy.");
+			}
+			// Arguments moved into the cache are only available after their broadcast has finished
+			else if (PendingCacheFills > 0)
+				PendingBelated.Add(delegate);
+			else if (Cache.IsSet())
+			{
+				if constexpr (FBelatedCalls::bDeferred)
+				{
+					if (!belated.Arguments.IsSet()) belated.Arguments = Cache;
+					belated.Delegates.Add(delegate);
+				}
+				else InvokeWithTuple(&delegate, &FDelegate::Execute, Cache.GetValue());
+			}
 		}
 		
 		using FBoundUFunction = TPair<TWeakObjectPtr<const UObject>, FName>;
 
-		bool bHasBroadcasted = false;
+		Detail::FBroadcastedFlag bHasBroadcasted;
 		
 		mutable TInitializeOnCopy<FCriticalSection> Mutex;
 		TSet<FDelegateHandle>                       OnlyNextDelegates;
 		TMap<FBoundUFunction, FDelegateHandle>      BoundUFunctionsMap;
-		TOptional<ArgumentsCache>                   Cache;
-		TMulticastDelegate<void(Args...), FDefaultDelegateUserPolicy> MulticastDelegate;
+		std::conditional_t<DefaultPolicy.NoArgumentCache, FVoid, TOptional<ArgumentsCache>> Cache;
+		std::conditional_t<DefaultPolicy.NoArgumentCache, FVoid, TArray<FDelegate>> PendingBelated;
+		int32 PendingCacheFills = 0;
+		std::conditional_t<
+			DefaultPolicy.LockFreeBroadcast,
+			Detail::TSnapshotListeners<Args...>,
+			std::conditional_t<
+				(DefaultPolicy.InlineListeners > 0),
+				Detail::TInlineListeners<DefaultPolicy.InlineListeners, Args...>,
+				TMulticastDelegate<void(Args...), FDefaultDelegateUserPolicy>
+			>
+		> MulticastDelegate;
 	};
 
+	/** @brief Shorthand alias for TEventDelegate which can be broadcast without locks, see `FEventPolicy::LockFreeBroadcast` */
+	template <typename Signature, FEventPolicy DefaultPolicy = {}>
+	using TLockFreeEventDelegate = TEventDelegate<Signature, DefaultPolicy.With({.LockFreeBroadcast = true})>;
+
 	/** @brief Shorthand alias for TEventDelegate which copies arguments to its cache regardless of their qualifiers */
 	template <typename Signature, FEventPolicy DefaultPolicy = {}>
 	using TRetainingEventDelegate = TEventDelegate<Signature, DefaultPolicy.With({.CacheViaCopy = true})>;
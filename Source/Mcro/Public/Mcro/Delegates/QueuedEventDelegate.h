@@ -0,0 +1,227 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#pragma once
+
+#include <atomic>
+
+#include "CoreMinimal.h"
+#include "Containers/Queue.h"
+#include "Mcro/Concepts.h"
+#include "Mcro/Threading.h"
+#include "Mcro/Delegates/EventDelegate.h"
+
+namespace Mcro::Delegates
+{
+	using namespace Mcro::Concepts;
+
+	/** @brief Settings for `TQueuedEventDelegate` which are independent from the settings of individual bindings */
+	struct FQueuedEventPolicy
+	{
+		/** @brief The named thread where queued broadcasts are delivered to the listeners */
+		ENamedThreads::Type Thread = ENamedThreads::GameThread;
+
+		/**
+		 *	@brief
+		 *	Deliver identical payloads only once per flush (in the order of their first broadcast). This is only
+		 *	considered when the arguments are equality comparable.
+		 */
+		bool CoalesceIdentical = false;
+	};
+
+	/**
+	 *	@brief
+	 *	A variant of `TEventDelegate` which can be broadcast from any thread, but its listeners are always executed on
+	 *	a chosen named thread. Broadcasts are copied into a lock-free multi-producer queue, and they're flushed in bulk
+	 *	on the target thread by a single task, which is only scheduled when the queue was empty. This way thousands of
+	 *	broadcasts per frame don't allocate thousands of tasks.
+	 *
+	 *	Bindings follow the same `FEventPolicy` semantics as `TEventDelegate` (`Once` listeners are removed after the
+	 *	next delivered broadcast, and `Belated` listeners are executed immediately, on the thread adding them, with
+	 *	the last delivered arguments).
+	 *
+	 *	Usage:
+	 *	@code
+	 *	TQueuedEventDelegate<void(int32 progress)> OnProgress {{ .Thread = ENamedThreads::GameThread }};
+	 *	OnProgress.Add(From(this, [this](int32 progress) { ProgressBar->SetPercent(progress / 100.f); }));
+	 *
+	 *	// on a worker thread
+	 *	OnProgress.Broadcast(42);
+	 *	@endcode
+	 *
+	 *	@remarks
+	 *	Broadcasts made on the target thread itself are delivered immediately when there's no flush pending,
+	 *	otherwise they're delivered with the pending flush, so delivery order is preserved. Broadcasts made by
+	 *	listeners during a flush are delivered by that flush, after the broadcasts it was already delivering.
+	 */
+	template <typename Function, FEventPolicy DefaultPolicy = {}>
+	class TQueuedEventDelegate {};
+
+	/** @copydoc TQueuedEventDelegate */
+	template <typename... Args, FEventPolicy DefaultPolicy>
+	class TQueuedEventDelegate<void(Args...), DefaultPolicy>
+	{
+	public:
+		/** Listeners may be added from any thread, and delivered arguments are owned by the queue */
+		using FEvent = TEventDelegate<void(Args...), DefaultPolicy.With({.CacheViaCopy = true, .ThreadSafe = true})>;
+		using FDelegate = typename FEvent::FDelegate;
+		using FPayload = TTuple<std::decay_t<Args>...>;
+
+		explicit TQueuedEventDelegate(FQueuedEventPolicy const& policy = {})
+			: Shared(MakeShared<FShared, ESPMode::ThreadSafe>(policy))
+		{}
+
+		TQueuedEventDelegate(TQueuedEventDelegate const&) = delete;
+		TQueuedEventDelegate& operator = (TQueuedEventDelegate const&) = delete;
+
+		/** @brief Queue a broadcast from any thread. The arguments are copied into the queue. */
+		template <typename... BroadcastArgs>
+		requires CConvertibleTo<TTuple<BroadcastArgs...>, TTuple<Args...>>
+		void Broadcast(BroadcastArgs&&... args)
+		{
+			Shared->Enqueue(FPayload(FWD(args)...));
+		}
+
+		/** @brief Deliver all queued broadcasts now. This should be called on the target thread. */
+		void Flush()
+		{
+			Shared->Flush();
+		}
+
+		/** @brief Equivalent to `TEventDelegate::Add` */
+		FDelegateHandle Add(FDelegate delegate, FEventPolicy const& policy = {})
+		{
+			return Shared->Event.Add(MoveTemp(delegate), policy);
+		}
+
+		/** @brief Equivalent to `TEventDelegate::Remove` */
+		bool Remove(FDelegateHandle const& handle)
+		{
+			return Shared->Event.Remove(handle);
+		}
+
+		/** @brief Equivalent to `TEventDelegate::RemoveAll` */
+		int32 RemoveAll(const void* object)
+		{
+			return Shared->Event.RemoveAll(object);
+		}
+
+		/** @returns true if this event delegate has any listeners. */
+		bool IsBound() const
+		{
+			return Shared->Event.IsBound();
+		}
+
+		/** @returns true if any queued broadcast has been delivered yet. */
+		bool IsBroadcasted() const
+		{
+			return Shared->Event.IsBroadcasted();
+		}
+
+	private:
+		/** Shared with the scheduled flush tasks, so they're safe to run after this delegate has been destroyed */
+		struct FShared : TSharedFromThis<FShared, ESPMode::ThreadSafe>
+		{
+			explicit FShared(FQueuedEventPolicy const& policy) : Policy(policy) {}
+
+			void Enqueue(FPayload&& payload)
+			{
+				Queue.Enqueue(MoveTemp(payload));
+				if (bFlushScheduled.exchange(true, std::memory_order_acq_rel)) return;
+
+				Threading::RunInThread(Policy.Thread, this->AsWeak(), [this] { Flush(); });
+			}
+
+			void Flush()
+			{
+				FScopeLock lock(&FlushMutex);
+
+				// Broadcasts made by listeners on the target thread re-enter here synchronously. Those are delivered by
+				// the outer flush instead, after the payloads it's already delivering, so order is preserved.
+				if (bFlushing) return;
+				TGuardValue flushingGuard(bFlushing, true);
+
+				TArray<FPayload, TInlineAllocator<16>> payloads;
+				for (;;)
+				{
+					// Broadcasts queued from now on need a new flush
+					bFlushScheduled.exchange(false, std::memory_order_acq_rel);
+
+					payloads.Reset();
+					Drain(payloads);
+					if (payloads.IsEmpty()) return;
+
+					// Payloads are delivered only once, so they're moved into the argument cache of the event instead of
+					// being copied.
+					for (FPayload& delivering : payloads)
+					{
+						[&] <size_t... I> (std::index_sequence<I...>)
+						{
+							Event.Broadcast(Deliverable<Args>(delivering.template Get<I>())...);
+						}(std::index_sequence_for<Args...>());
+					}
+				}
+			}
+
+			/** Move payload items, unless the listener expects a mutable reference to them */
+			template <typename Arg, typename Value>
+			static FORCEINLINE decltype(auto) Deliverable(Value& value)
+			{
+				if constexpr (std::is_lvalue_reference_v<Arg> && !std::is_const_v<std::remove_reference_t<Arg>>)
+					return (value);
+				else return MoveTemp(value);
+			}
+
+			template <typename Payloads>
+			void Drain(Payloads& payloads)
+			{
+				constexpr bool coalescable = CCoreEqualityComparable<FPayload>;
+				constexpr bool hashable = requires(FPayload const& payload) { GetTypeHash(payload); };
+				
+				// Indices of payloads by their hash, for coalescing identical payloads without quadratic lookups
+				TMultiMap<uint32, int32> seen;
+				
+				while (FPayload* next = Queue.Peek())
+				{
+					bool skip = false;
+					if constexpr (coalescable && hashable)
+					{
+						if (Policy.CoalesceIdentical)
+						{
+							const uint32 hash = GetTypeHash(*next);
+							for (auto it = seen.CreateConstKeyIterator(hash); it && !skip; ++it)
+								skip = payloads[it.Value()] == *next;
+							if (!skip) seen.Add(hash, payloads.Num());
+						}
+					}
+					else if constexpr (coalescable)
+						skip = Policy.CoalesceIdentical && payloads.Contains(*next);
+
+					if (!skip) payloads.Add(MoveTemp(*next));
+					Queue.Pop();
+				}
+			}
+
+			FQueuedEventPolicy Policy;
+			FEvent Event;
+			TQueue<FPayload, EQueueMode::Mpsc> Queue;
+			std::atomic<bool> bFlushScheduled { false };
+
+			/** Only accessed by the thread holding `FlushMutex` */
+			bool bFlushing = false;
+
+			/** Only consumers contend on this lock, producers never take it */
+			FCriticalSection FlushMutex;
+		};
+
+		TSharedRef<FShared, ESPMode::ThreadSafe> Shared;
+	};
+}
@@ -20,6 +20,7 @@ namespace Mcro::Error
 	using namespace Mcro::Concepts;
 	
 	class IError;
+	class IErrorSerializer;
 	class SErrorDisplay;
 	
 	using IErrorRef = TSharedRef<IError>;   /**< @brief Convenience alias for an instance of an error */
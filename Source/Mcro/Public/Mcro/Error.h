@@ -11,12 +11,15 @@
 
 #pragma once
 
+#include <atomic>
+
 #include "CoreMinimal.h"
 #include "Templates/ValueOrError.h"
 #include "Mcro/Error.Fwd.h"
 #include "Void.h"
 #include "Mcro/Types.h"
 #include "Mcro/Concepts.h"
+#include "Mcro/InitializeOnCopy.h"
 #include "Mcro/SharedObjects.h"
 #include "Mcro/Observable.Fwd.h"
 #include "Mcro/TextMacros.h"
@@ -37,6 +40,30 @@ namespace Mcro::Error
 	using namespace Mcro::FunctionTraits;
 	using namespace Mcro::SharedObjects;
 	using namespace Mcro::Delegates;
+	using namespace Mcro::InitializeOnCopy;
+
+	/**
+	 *	@brief
+	 *	The format string argument of the formatting methods of `IError`. String literals are kept as pointers along
+	 *	with their format arguments, and they're formatted only when the text is first read. Any other format string
+	 *	is formatted immediately, as it may not outlive the error.
+	 *
+	 *	Character arrays are only accepted when their address is a compile time constant, so arrays with automatic
+	 *	storage (like local buffers) are rejected at compile time instead of leaving a dangling format behind. Cast
+	 *	those to `const TCHAR*` to format them immediately.
+	 */
+	struct FErrorFormat
+	{
+		template <size_t N>
+		consteval FErrorFormat(const TCHAR (&literal)[N]) : Format(literal), bLiteral(true) {}
+
+		template <typename T>
+		requires (CConvertibleTo<T, const TCHAR*> && !std::is_array_v<std::remove_reference_t<T>>)
+		FErrorFormat(T&& format) : Format(format), bLiteral(false) {}
+
+		const TCHAR* Format;
+		bool bLiteral;
+	};
 
 	/**
 	 *	@brief  A base class for a structured error handling and reporting with modular architecture and fluent API.
@@ -70,11 +97,79 @@ namespace Mcro::Error
 		TMap<FString, IErrorRef> InnerErrors;
 		TArray<std::source_location> ErrorPropagation;
 		EErrorSeverity Severity = EErrorSeverity::ErrorComponent;
-		FString Message;
-		FString Details;
+
+		/** @brief A format and its arguments which are rendered only when the text is first read */
+		struct FDeferredFormat
+		{
+			const TCHAR* Format = nullptr;
+			FStringFormatOrderedArguments Arguments;
+		};
+
+		/** Whether an error may still have deferred texts to render, it can be read from any thread without locking */
+		class FDeferredTextFlag
+		{
+		public:
+			FDeferredTextFlag() = default;
+			FDeferredTextFlag(FDeferredTextFlag const& other) : Value(other.Get()) {}
+			FDeferredTextFlag& operator = (FDeferredTextFlag const& other)
+			{
+				Value.store(other.Get(), std::memory_order_release);
+				return *this;
+			}
+			FDeferredTextFlag& operator = (bool value)
+			{
+				Value.store(value, std::memory_order_release);
+				return *this;
+			}
+
+			FORCEINLINE bool Get() const { return Value.load(std::memory_order_acquire); }
+			FORCEINLINE operator bool () const { return Get(); }
+
+		private:
+			std::atomic<bool> Value { false };
+		};
+
+		/** Formatted texts are rendered only when they're read, so these may be set from const accessors */
+		mutable FString Message;
+		mutable FString Details;
+		mutable TOptional<FDeferredFormat> DeferredMessage;
+		mutable TOptional<FDeferredFormat> DeferredDetails;
+
+		/**
+		 *	Set when a deferred text is stored, and cleared once they're rendered, so reading an already rendered error
+		 *	doesn't need to lock `RenderMutex`.
+		 */
+		mutable FDeferredTextFlag bHasDeferredText;
+
+		/** Errors may be read from multiple threads once they're submitted, so rendering deferred texts is guarded */
+		mutable TInitializeOnCopy<FCriticalSection> RenderMutex;
 		FString CodeContext;
 		mutable bool bIsRoot = false;
 
+		/** @brief Literal formats are stored with their arguments and formatted only when they're read, see `FErrorFormat` */
+		template <typename... FormatArgs>
+		void SetFormatted(FString& target, TOptional<FDeferredFormat>& deferred, FErrorFormat input, FormatArgs&&... fmtArgs)
+		{
+			if (input.bLiteral)
+			{
+				target.Reset();
+				deferred.Emplace(FDeferredFormat { input.Format, OrderedArguments(FWD(fmtArgs)...) });
+				bHasDeferredText = true;
+			}
+			else
+			{
+				deferred.Reset();
+				target = FString::Format(input.Format, OrderedArguments(FWD(fmtArgs)...));
+			}
+		}
+
+		/**
+		 *	@brief
+		 *	Render the deferred formats of Message and Details. Call it before reading them directly. Override it
+		 *	when an error type populates its Message or Details lazily.
+		 */
+		virtual void RenderDeferredText() const;
+
 		/** @brief Override this method if inner errors needs custom way of serialization */
 		virtual void SerializeInnerErrors(YAML::Emitter& emitter) const;
 		
@@ -87,6 +182,18 @@ namespace Mcro::Error
 		/** @brief Add extra separate blocks of text in an ad-hoc fashion */
 		virtual void AddAppendix(const FString& name, const FString& text, const FString& type = TEXT_"Appendix");
 
+		/** @brief Add extra separate blocks of text which are formatted only when they're first read */
+		virtual void AddDeferredAppendix(const FString& name, FDeferredFormat&& text, const FString& type = TEXT_"Appendix");
+
+		template <typename... FormatArgs>
+		void AddFormattedAppendix(const FString& name, FErrorFormat text, FormatArgs&&... fmtArgs)
+		{
+			if (text.bLiteral)
+				AddDeferredAppendix(name, { text.Format, OrderedArguments(FWD(fmtArgs)...) });
+			else
+				AddAppendix(name, FString::Format(text.Format, OrderedArguments(FWD(fmtArgs)...)));
+		}
+
 		void AddCppStackTrace(const FString& name, int32 numAdditionalStackFramesToIgnore, bool fastWalk);
 		void AddBlueprintStackTrace(const FString& name);
 
@@ -97,6 +204,15 @@ namespace Mcro::Error
 		 */
 		virtual void SerializeMembers(YAML::Emitter& emitter) const;
 
+		/**
+		 * 	@brief
+		 *	Override this method if direct members should be written differently to streaming serializers or extra
+		 *	members are added by derived errors.
+		 *
+		 *	@param isRoot  True if this error is the root of the serialized error tree
+		 */
+		virtual void SerializeFields(IErrorSerializer& serializer, bool isRoot) const;
+
 		virtual void NotifyState(Observable::IState<IErrorPtr>& state);
 		
 	public:
@@ -122,6 +238,17 @@ namespace Mcro::Error
 		 */
 		virtual void SerializeYaml(YAML::Emitter& emitter) const;
 
+		/**
+		 *	@brief
+		 *	Write this error and its inner errors to a streaming serializer, without building an intermediate
+		 *	document or strings. Prefer this over the YAML representation when errors are written to disk or sent
+		 *	to telemetry.
+		 *
+		 *	@param serializer  For example `FJsonLinesErrorWriter` or `FBinaryErrorWriter`
+		 *	@param       name  The key of this error among the inner errors of its parent, empty for root errors
+		 */
+		void Serialize(IErrorSerializer& serializer, FStringView name = {}) const;
+
 		/** @brief Overload append operator for YAML::Emitter */
 		friend auto operator << (YAML::Emitter& emitter, IErrorRef const& error) -> YAML::Emitter&;
 
@@ -161,8 +288,8 @@ namespace Mcro::Error
 
 		FORCEINLINE EErrorSeverity                  GetSeverity() const        { return Severity; }
 		FORCEINLINE int32                           GetSeverityInt() const     { return static_cast<int32>(Severity); }
-		FORCEINLINE FString const&                  GetMessage() const         { return Message; }
-		FORCEINLINE FString const&                  GetDetails() const         { return Details; }
+		FORCEINLINE FString const&                  GetMessage() const         { RenderDeferredText(); return Message; }
+		FORCEINLINE FString const&                  GetDetails() const         { RenderDeferredText(); return Details; }
 		FORCEINLINE FString const&                  GetCodeContext() const     { return CodeContext; }
 		FORCEINLINE TMap<FString, IErrorRef> const& GetInnerErrors() const     { return InnerErrors; }
 		FORCEINLINE int32                           GetInnerErrorCount() const { return InnerErrors.Num(); }
@@ -195,7 +322,11 @@ namespace Mcro::Error
 		template <typename Self>
 		SelfRef<Self> WithMessage(this Self&& self, const FString& input, bool condition = true)
 		{
-			if (condition) self.Message = input;
+			if (condition)
+			{
+				self.Message = input;
+				self.DeferredMessage.Reset();
+			}
 			return self.SharedThis(&self);
 		}
 
@@ -208,9 +339,9 @@ namespace Mcro::Error
 		 *	@return  Self for further fluent API setup
 		 */
 		template <typename Self, CStringFormatArgument... FormatArgs>
-		SelfRef<Self> WithMessageF(this Self&& self, const TCHAR* input, FormatArgs&&... fmtArgs)
+		SelfRef<Self> WithMessageF(this Self&& self, FErrorFormat input, FormatArgs&&... fmtArgs)
 		{
-			self.Message = FString::Format(input, OrderedArguments(FWD(fmtArgs)...));
+			self.SetFormatted(self.Message, self.DeferredMessage, input, FWD(fmtArgs)...);
 			return self.SharedThis(&self);
 		}
 
@@ -224,9 +355,9 @@ namespace Mcro::Error
 		 *	@return  Self for further fluent API setup
 		 */
 		template <typename Self, typename... FormatArgs>
-		SelfRef<Self> WithMessageFC(this Self&& self, bool condition, const TCHAR* input, FormatArgs&&... fmtArgs)
+		SelfRef<Self> WithMessageFC(this Self&& self, bool condition, FErrorFormat input, FormatArgs&&... fmtArgs)
 		{
-			if (condition) self.Message = FString::Format(input, OrderedArguments(FWD(fmtArgs)...));
+			if (condition) self.SetFormatted(self.Message, self.DeferredMessage, input, FWD(fmtArgs)...);
 			return self.SharedThis(&self);
 		}
 		
@@ -283,7 +414,11 @@ namespace Mcro::Error
 		template <typename Self>
 		SelfRef<Self> WithDetails(this Self&& self, const FString& input, bool condition = true)
 		{
-			if (condition) self.Details = input;
+			if (condition)
+			{
+				self.Details = input;
+				self.DeferredDetails.Reset();
+			}
 			return self.SharedThis(&self);
 		}
 
@@ -299,9 +434,9 @@ namespace Mcro::Error
 		 *	@return  Self for further fluent API setup
 		 */
 		template <typename Self, CStringFormatArgument... FormatArgs>
-		SelfRef<Self> WithDetailsF(this Self&& self, const TCHAR* input, FormatArgs&&... fmtArgs)
+		SelfRef<Self> WithDetailsF(this Self&& self, FErrorFormat input, FormatArgs&&... fmtArgs)
 		{
-			self.Details = FString::Format(input, OrderedArguments(FWD(fmtArgs)...));
+			self.SetFormatted(self.Details, self.DeferredDetails, input, FWD(fmtArgs)...);
 			return self.SharedThis(&self);
 		}
 
@@ -318,9 +453,9 @@ namespace Mcro::Error
 		 *	@return  Self for further fluent API setup
 		 */
 		template <typename Self, CStringFormatArgument... FormatArgs>
-		SelfRef<Self> WithDetailsFC(this Self&& self, bool condition, const TCHAR* input, FormatArgs&&... fmtArgs)
+		SelfRef<Self> WithDetailsFC(this Self&& self, bool condition, FErrorFormat input, FormatArgs&&... fmtArgs)
 		{
-			if (condition) self.Details = FString::Format(input, OrderedArguments(FWD(fmtArgs)...));
+			if (condition) self.SetFormatted(self.Details, self.DeferredDetails, input, FWD(fmtArgs)...);
 			return self.SharedThis(&self);
 		}
 
@@ -443,9 +578,9 @@ namespace Mcro::Error
 		 *	@return  Self for further fluent API setup
 		 */
 		template <typename Self, CStringFormatArgument... FormatArgs>
-		SelfRef<Self> WithAppendixF(this Self&& self, const FString& name, const TCHAR* text, FormatArgs&&... fmtArgs)
+		SelfRef<Self> WithAppendixF(this Self&& self, const FString& name, FErrorFormat text, FormatArgs&&... fmtArgs)
 		{
-			self.AddAppendix(name, FString::Format(text, OrderedArguments(FWD(fmtArgs)...)));
+			self.AddFormattedAppendix(name, text, FWD(fmtArgs)...);
 			return self.SharedThis(&self);
 		}
 
@@ -459,10 +594,10 @@ namespace Mcro::Error
 		 *	@return  Self for further fluent API setup
 		 */
 		template <typename Self, CStringFormatArgument... FormatArgs>
-		SelfRef<Self> WithAppendixFC(this Self&& self, bool condition, const FString& name, const TCHAR* text, FormatArgs&&... fmtArgs)
+		SelfRef<Self> WithAppendixFC(this Self&& self, bool condition, const FString& name, FErrorFormat text, FormatArgs&&... fmtArgs)
 		{
 			if (condition)
-				self.AddAppendix(name, FString::Format(text, OrderedArguments(FWD(fmtArgs)...)));
+				self.AddFormattedAppendix(name, text, FWD(fmtArgs)...);
 			return self.SharedThis(&self);
 		}
 
@@ -578,12 +713,121 @@ namespace Mcro::Error
 		FUnavailable();
 	};
 
+	template <CNonVoid T>
+	struct TMaybe;
+
+	namespace Detail
+	{
+		template <typename>
+		constexpr bool IsMaybe = false;
+
+		template <typename T>
+		constexpr bool IsMaybe<TMaybe<T>> = true;
+
+		struct FMaybeValueTag {};
+		struct FMaybeErrorTag {};
+
+		/**
+		 *	Storage of TMaybe where the value and the error share the same memory, as only one of them is present at
+		 *	a time. It's bitwise relocatable whenever T is, as the error pointer is bitwise relocatable.
+		 */
+		template <typename T>
+		class TMaybeStorage
+		{
+		public:
+			template <typename... Args>
+			TMaybeStorage(FMaybeValueTag, Args&&... args) : Value(FWD(args)...), bHasValue(true) {}
+			TMaybeStorage(FMaybeErrorTag, IErrorPtr&& error) : Error(MoveTemp(error)), bHasValue(false) {}
+
+			TMaybeStorage(TMaybeStorage const& other) requires CCopyConstructible<T>
+				: bHasValue(other.bHasValue)
+			{
+				if (bHasValue) new (&Value) T(other.Value);
+				else new (&Error) IErrorPtr(other.Error);
+			}
+
+			TMaybeStorage(TMaybeStorage&& other) requires CMoveConstructible<T>
+				: bHasValue(other.bHasValue)
+			{
+				if (bHasValue) new (&Value) T(MoveTemp(other.Value));
+				else new (&Error) IErrorPtr(MoveTemp(other.Error));
+			}
+
+			TMaybeStorage& operator = (TMaybeStorage const& other) requires CCopyConstructible<T>
+			{
+				if (this != &other)
+				{
+					Destroy();
+					new (this) TMaybeStorage(other);
+				}
+				return *this;
+			}
+
+			TMaybeStorage& operator = (TMaybeStorage&& other) requires CMoveConstructible<T>
+			{
+				if (this != &other)
+				{
+					Destroy();
+					new (this) TMaybeStorage(MoveTemp(other));
+				}
+				return *this;
+			}
+
+			~TMaybeStorage() { Destroy(); }
+
+			FORCEINLINE bool HasValue() const { return bHasValue; }
+			FORCEINLINE T&       GetValue()       { return Value; }
+			FORCEINLINE T const& GetValue() const { return Value; }
+			FORCEINLINE IErrorPtr GetError() const { return bHasValue ? IErrorPtr() : Error; }
+
+		private:
+			void Destroy()
+			{
+				if (bHasValue) Value.~T();
+				else Error.~IErrorPtr();
+			}
+
+			union
+			{
+				T Value;
+				IErrorPtr Error;
+			};
+			bool bHasValue;
+		};
+
+		/** Storage of TMaybe for empty value types (like the FVoid of FCanFail), which is only the error pointer */
+		template <typename T>
+		requires (std::is_empty_v<T> && !std::is_final_v<T>)
+		class TMaybeStorage<T> : private T
+		{
+		public:
+			template <typename... Args>
+			TMaybeStorage(FMaybeValueTag, Args&&... args) : T(FWD(args)...) {}
+			TMaybeStorage(FMaybeErrorTag, IErrorPtr&& error) : Error(MoveTemp(error)) {}
+
+			FORCEINLINE bool HasValue() const { return !Error.IsValid(); }
+			FORCEINLINE T&       GetValue()       { return static_cast<T&>(*this); }
+			FORCEINLINE T const& GetValue() const { return static_cast<T const&>(*this); }
+			FORCEINLINE IErrorPtr GetError() const { return Error; }
+
+		private:
+			IErrorPtr Error;
+		};
+	}
+
+	/** @brief Concept constraining input type argument T to be a TMaybe */
+	template <typename T>
+	concept CMaybe = Detail::IsMaybe<std::decay_t<T>>;
+
 	/**
 	 *	@brief
 	 *	A `TValueOrError` alternative for IError which allows implicit conversion from values and errors (no need for
 	 *	`MakeError` or `MakeValue`) and is boolean testable. It also doesn't have ambiguous state such as
 	 *	`TValueOrError` has, so a TMaybe will always have either an error or a value, it will never have neither of
 	 *	them or both of them.
+	 *
+	 *	The value and the error share the same storage, so a successful TMaybe is not much larger than its value,
+	 *	and `FCanFail` is only an error pointer.
 	 */
 	template <CNonVoid T>
 	struct TMaybe
@@ -597,7 +841,7 @@ namespace Mcro::Error
 		 */
 		template <typename = T>
 		requires (!CDefaultInitializable<T>)
-		TMaybe() : Error(IError::Make(new FUnavailable())
+		TMaybe() : Storage(Detail::FMaybeErrorTag(), IError::Make(new FUnavailable())
 			->WithMessageF(
 				TEXT_"TMaybe has been default initialized, but a Value of {0} cannot be default initialized",
 				TTypeName<T>
@@ -606,41 +850,56 @@ namespace Mcro::Error
 
 		/** @brief If T is default initializable then the default state of TMaybe will be the default value of T, and not an error */
 		template <CDefaultInitializable = T>
-		TMaybe() : Value(T{}) {}
+		TMaybe() : Storage(Detail::FMaybeValueTag()) {}
 		
 		/** @brief Enable copy constructor for T only when T is copy constructable */
 		template <CConvertibleToDecayed<T> From, CCopyConstructible = T>
-		TMaybe(From const& value) : Value(value) {}
+		requires (!CErrorRefOrPtr<std::decay_t<From>>)
+		TMaybe(From const& value) : Storage(Detail::FMaybeValueTag(), value) {}
 		
 		/** @brief Enable move constructor for T only when T is move constructable */
 		template <CConvertibleToDecayed<T> From, CMoveConstructible = T>
-		TMaybe(From&& value) : Value(FWD(value)) {}
+		requires (!CErrorRefOrPtr<std::decay_t<From>>)
+		TMaybe(From&& value) : Storage(Detail::FMaybeValueTag(), FWD(value)) {}
 		
 		/** @brief Enable copy constructor for TMaybe only when T is copy constructable */
 		template <CConvertibleToDecayed<T> From, CCopyConstructible = T>
-		TMaybe(TMaybe<From> const& other) : Value(other.Value) {}
+		TMaybe(TMaybe<From> const& other) : Storage(ConvertStorage(other)) {}
 		
 		/** @brief Enable move constructor for TMaybe only when T is move constructable */
 		template <CConvertibleToDecayed<T> From, CMoveConstructible = T>
-		TMaybe(TMaybe<From>&& other) : Value(MoveTemp(other.Value)) {}
+		TMaybe(TMaybe<From>&& other) : Storage(ConvertStorage(MoveTemp(other))) {}
 
 		/** @brief Set this TMaybe to an erroneous state */
 		template <CError ErrorType>
-		TMaybe(TSharedRef<ErrorType> const& error) : Error(error) {}
+		TMaybe(TSharedRef<ErrorType> const& error) : Storage(Detail::FMaybeErrorTag(), error) {}
 
-		bool HasValue() const { return Value.IsSet(); }
-		bool HasError() const { return Error.IsValid(); }
+		/**
+		 *	@brief
+		 *	Set this TMaybe to an erroneous state. A TMaybe never has neither a value nor an error, so a null error
+		 *	pointer is replaced with an `FUnavailable` error.
+		 */
+		template <CError ErrorType>
+		TMaybe(TSharedPtr<ErrorType> const& error)
+			: Storage(Detail::FMaybeErrorTag(), error ? IErrorPtr(error) : IError::Make(new FUnavailable())
+				->WithMessage(TEXT_"TMaybe has been initialized with a null error pointer")
+			)
+		{}
 
-		auto TryGetValue()       -> TOptional<T>&       { return Value; }
-		auto TryGetValue() const -> TOptional<T> const& { return Value; }
+		bool HasValue() const { return Storage.HasValue(); }
+		bool HasError() const { return !Storage.HasValue(); }
+
+		/** @return Pointer to the value, or nullptr if this TMaybe has an error */
+		auto TryGetValue()       -> T*       { return HasValue() ? &Storage.GetValue() : nullptr; }
+		auto TryGetValue() const -> T const* { return HasValue() ? &Storage.GetValue() : nullptr; }
 		
-		auto GetValue()       -> T&       { return Value.GetValue(); }
-		auto GetValue() const -> T const& { return Value.GetValue(); }
+		auto GetValue()       -> T&       { check(HasValue()); return Storage.GetValue(); }
+		auto GetValue() const -> T const& { check(HasValue()); return Storage.GetValue(); }
 
-		T&& StealValue() && { return MoveTemp(Value.GetValue()); }
+		T&& StealValue() && { return MoveTemp(GetValue()); }
 
-		auto GetError() const -> IErrorPtr { return Error; }
-		auto GetErrorRef() const -> IErrorRef { return Error.ToSharedRef(); }
+		auto GetError() const -> IErrorPtr { return Storage.GetError(); }
+		auto GetErrorRef() const -> IErrorRef { return GetError().ToSharedRef(); }
 
 		operator bool() const { return HasValue(); }
 
@@ -658,17 +917,74 @@ namespace Mcro::Error
 			if (self.HasError()) mod(self.GetErrorRef());
 			return FWD(self);
 		}
+
+		/**
+		 *	@brief
+		 *	Transform the value of this monad with a function, or propagate its error. The value is moved into the
+		 *	function, so this is only available on r-value TMaybe's.
+		 *	
+		 *	@param function  Its result is the value of the returned TMaybe, or FCanFail when it returns void
+		 *	@return  A TMaybe of the result of the function, or the error of this monad
+		 */
+		template <typename Function>
+		requires std::is_invocable_v<Function, T&&>
+		auto Map(Function&& function) &&
+		{
+			using Result = std::invoke_result_t<Function, T&&>;
+			using FResult = TMaybe<std::conditional_t<std::is_void_v<Result>, FVoid, std::decay_t<Result>>>;
+
+			if (HasError()) return FResult(GetErrorRef());
+			if constexpr (std::is_void_v<Result>)
+			{
+				function(MoveTemp(Storage.GetValue()));
+				return FResult(FVoid());
+			}
+			else return FResult(function(MoveTemp(Storage.GetValue())));
+		}
+
+		/**
+		 *	@brief
+		 *	Continue with another function which may fail, or propagate the error of this monad. The value is moved
+		 *	into the function, so this is only available on r-value TMaybe's.
+		 *	
+		 *	@param function  Returning another TMaybe
+		 *	@return  The result of the function, or the error of this monad
+		 */
+		template <typename Function>
+		requires std::is_invocable_v<Function, T&&> && CMaybe<std::invoke_result_t<Function, T&&>>
+		auto AndThen(Function&& function) && -> std::decay_t<std::invoke_result_t<Function, T&&>>
+		{
+			if (HasError()) return GetErrorRef();
+			return function(MoveTemp(Storage.GetValue()));
+		}
 		
 		operator TValueOrError<T, IErrorPtr>() const
 		{
 			if (HasValue())
-				return MakeValue(Value.GetValue());
-			return MakeError(Error);
+				return MakeValue(GetValue());
+			return MakeError(GetError());
 		}
 
 	private:
-		TOptional<T> Value;
-		IErrorPtr Error;
+		template <CNonVoid>
+		friend struct TMaybe;
+
+		using FStorage = Detail::TMaybeStorage<T>;
+
+		template <typename Other>
+		static FStorage ConvertStorage(Other&& other)
+		{
+			if (other.HasValue())
+			{
+				if constexpr (std::is_lvalue_reference_v<Other>)
+					return FStorage(Detail::FMaybeValueTag(), other.Storage.GetValue());
+				else
+					return FStorage(Detail::FMaybeValueTag(), MoveTemp(other.Storage.GetValue()));
+			}
+			return FStorage(Detail::FMaybeErrorTag(), other.GetError());
+		}
+
+		FStorage Storage;
 	};
 
 	/** @brief Indicate that an otherwise void function that it may fail with an IError. */
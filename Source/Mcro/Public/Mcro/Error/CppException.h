@@ -39,6 +39,7 @@ namespace Mcro::Error
 	protected:
 		virtual FStringView GetExceptionType() const;
 		virtual void SerializeMembers(YAML::Emitter& emitter) const override;
+		virtual void SerializeFields(IErrorSerializer& serializer, bool isRoot) const override;
 	};
 
 	/**
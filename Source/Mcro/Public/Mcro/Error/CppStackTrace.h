@@ -14,9 +14,22 @@
 #include "CoreMinimal.h"
 #include "Mcro/Error/PlainTextComponent.h"
 
+#ifndef MCRO_CPP_STACK_TRACE_MAX_DEPTH
+/** @brief The maximum number of stack frames captured by `FCppStackTrace` */
+#define MCRO_CPP_STACK_TRACE_MAX_DEPTH 64
+#endif
+
 namespace Mcro::Error
 {
-	/** @brief An Error component which stores a C++ stack trace in its message upon construction. */
+	/**
+	 *	@brief
+	 *	An Error component which stores a C++ stack trace. With fast stack walking only the raw program counters are
+	 *	captured upon construction, and they're symbolicated only when this error is serialized or displayed.
+	 *	Symbols of program counters are cached for the entire process, so they're resolved only once across errors.
+	 *
+	 *	Reading the message (via `GetMessage` or when serialized) resolves the stack trace, its message is the same
+	 *	as `GetStackTrace`.
+	 */
 	class MCRO_API FCppStackTrace : public IPlainTextComponent
 	{
 	public:
@@ -25,7 +38,8 @@ namespace Mcro::Error
 		 *	Ignore stack frames which might be irrelevant for the error report
 		 *	
 		 *	@param fastWalk
-		 *	Use fast stack trace walking instead of accurate
+		 *	Use fast stack trace walking instead of accurate. Fast stack traces are symbolicated lazily, accurate
+		 *	stack traces are symbolicated immediately.
 		 *	
 		 *	@param stackFramesIgnoreDefaultOffset
 		 *	A default offset applied to ignore-stack-frames which accounts for the facilities of IError. Only set this
@@ -38,5 +52,21 @@ namespace Mcro::Error
 			bool fastWalk = !UE_BUILD_DEBUG,
 			int32 stackFramesIgnoreDefaultOffset = 1
 		);
+
+		/** @brief The captured program counters, the first one is the innermost frame */
+		FORCEINLINE TConstArrayView<uint64> GetProgramCounters() const { return ProgramCounters; }
+
+		/** @brief Get the human-readable stack trace, symbolicating it on first access */
+		FString const& GetStackTrace() const;
+
+	protected:
+		virtual void RenderDeferredText() const override;
+		virtual void SerializeYaml(YAML::Emitter& emitter) const override;
+		virtual void SerializeFields(IErrorSerializer& serializer, bool isRoot) const override;
+
+	private:
+		TArray<uint64, TInlineAllocator<MCRO_CPP_STACK_TRACE_MAX_DEPTH>> ProgramCounters;
+		mutable TOptional<FString> StackTrace;
+		mutable FCriticalSection ResolveMutex;
 	};
 }
@@ -0,0 +1,138 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+
+#pragma once
+
+#include <source_location>
+
+#include "CoreMinimal.h"
+#include "Mcro/Error.Fwd.h"
+
+namespace Mcro::Error
+{
+	/**
+	 *	@brief
+	 *	Interface for streaming serializers of IError trees, an alternative to the YAML representation for machines.
+	 *	`IError::Serialize` walks an error and its inner errors, and calls these functions in order without building
+	 *	intermediate documents or strings:
+	 *	
+	 *	- `BeginError`
+	 *	- `WriteField` for each direct member of the error
+	 *	- `WritePropagation` for each recorded source location
+	 *	- `BeginError` ... `EndError` recursively for each inner error
+	 *	- `EndError`
+	 *	
+	 *	Usage:
+	 *	@code
+	 *	TUniquePtr<FArchive> file(IFileManager::Get().CreateFileWriter(*path, FILEWRITE_Append));
+	 *	FJsonLinesErrorWriter writer(*file);
+	 *	error->Serialize(writer);
+	 *	@endcode
+	 */
+	class MCRO_API IErrorSerializer
+	{
+	public:
+		virtual ~IErrorSerializer() = default;
+
+		/** @param name  The key of the error among the inner errors of its parent, empty for the root error */
+		virtual void BeginError(FStringView name) = 0;
+		
+		virtual void WriteField(FAnsiStringView field, FStringView value) = 0;
+		virtual void WritePropagation(std::source_location const& location) = 0;
+		virtual void EndError() = 0;
+	};
+
+	/**
+	 *	@brief
+	 *	Write errors as JSON objects in UTF-8, one root error per line, directly to an archive. Members of errors are
+	 *	written with the same names as in their YAML representation.
+	 */
+	class MCRO_API FJsonLinesErrorWriter : public IErrorSerializer
+	{
+	public:
+		explicit FJsonLinesErrorWriter(FArchive& archive) : Archive(archive) {}
+
+		virtual void BeginError(FStringView name) override;
+		virtual void WriteField(FAnsiStringView field, FStringView value) override;
+		virtual void WritePropagation(std::source_location const& location) override;
+		virtual void EndError() override;
+
+	private:
+		enum class ESection : uint8
+		{
+			Fields,
+			Propagation,
+			InnerErrors
+		};
+
+		struct FLevel
+		{
+			ESection Section = ESection::Fields;
+			bool bObjectEmpty = true;
+			bool bSectionEmpty = true;
+		};
+
+		void EnterSection(ESection section);
+		void WriteItemSeparator();
+		void WriteRaw(FAnsiStringView text);
+		void WriteEscaped(FAnsiStringView text);
+		void WriteString(FAnsiStringView text);
+		void WriteString(FStringView text);
+
+		FArchive& Archive;
+		TArray<FLevel, TInlineAllocator<8>> Levels;
+	};
+
+	/**
+	 *	@brief
+	 *	Write errors in a compact binary format directly to an archive. Each root error starts with a header, then
+	 *	the following records are written in the order of `IErrorSerializer` calls. Integers follow the byte order
+	 *	of the archive, strings are written as a `uint32` byte count followed by UTF-8 bytes without terminator.
+	 *	
+	 *	| Record           | Tag (`uint8`) | Payload                                         |
+	 *	|------------------|---------------|-------------------------------------------------|
+	 *	| Header           | 0             | `uint8` format version                          |
+	 *	| BeginError       | 1             | name                                            |
+	 *	| Field            | 2             | field name, value                               |
+	 *	| Propagation      | 3             | function name, file name, `uint32` line         |
+	 *	| EndError         | 4             |                                                 |
+	 */
+	class MCRO_API FBinaryErrorWriter : public IErrorSerializer
+	{
+	public:
+		enum class ETag : uint8
+		{
+			Header,
+			BeginError,
+			Field,
+			Propagation,
+			EndError
+		};
+
+		static constexpr uint8 FormatVersion = 1;
+
+		explicit FBinaryErrorWriter(FArchive& archive) : Archive(archive) {}
+
+		virtual void BeginError(FStringView name) override;
+		virtual void WriteField(FAnsiStringView field, FStringView value) override;
+		virtual void WritePropagation(std::source_location const& location) override;
+		virtual void EndError() override;
+
+	private:
+		void WriteTag(ETag tag);
+		void WriteString(FAnsiStringView text);
+		void WriteString(FStringView text);
+
+		FArchive& Archive;
+		int32 Depth = 0;
+	};
+}
@@ -20,6 +20,11 @@
 #include "CoreMinimal.h"
 #include "Mcro/FunctionTraits.h"
 
+/** @brief The largest value in bytes which can be read without locks from a `TState` with `LockFreeRead` policy */
+#ifndef MCRO_STATE_LOCK_FREE_READ_MAX_SIZE
+#define MCRO_STATE_LOCK_FREE_READ_MAX_SIZE 64
+#endif
+
 namespace Mcro::Observable
 {
 	using namespace Mcro::FunctionTraits;
@@ -54,6 +59,23 @@ namespace Mcro::Observable
 		 */
 		bool ThreadSafe = false;
 
+		/**
+		 *	@brief
+		 *	Keep a copy of the value under a sequence lock, so `TState::GetSnapshot` can read a consistent copy of it
+		 *	from any thread without taking locks. Readers retry when they overlap with a write. Writers still
+		 *	broadcast changes as usual. Only available for small trivially copyable values (see `CLockFreeStateValue`),
+		 *	meant for states which are written by one thread, but read frequently by others.
+		 */
+		bool LockFreeRead = false;
+
+		/**
+		 *	@brief
+		 *	Keep the last N values of the state (including the current one) in a preallocated ring buffer, which can
+		 *	be accessed via `TState::GetHistory`. Zero disables history. Values are copied into the buffer on each
+		 *	change, without allocating the buffer itself, so T must be default initializable and copyable.
+		 */
+		int32 StoreHistory = 0;
+
 		/** @brief Merge two policy flags */
 		FORCEINLINE constexpr FStatePolicy With(FStatePolicy const& other) const
 		{
@@ -62,7 +84,9 @@ namespace Mcro::Observable
 				AlwaysNotify        || other.AlwaysNotify,
 				StorePrevious       || other.StorePrevious,
 				AlwaysStorePrevious || other.AlwaysStorePrevious,
-				ThreadSafe          || other.ThreadSafe
+				ThreadSafe          || other.ThreadSafe,
+				LockFreeRead        || other.LockFreeRead,
+				StoreHistory > other.StoreHistory ? StoreHistory : other.StoreHistory
 			};
 		}
 
@@ -73,6 +97,8 @@ namespace Mcro::Observable
 				&& lhs.StorePrevious       == rhs.StorePrevious
 				&& lhs.AlwaysStorePrevious == rhs.AlwaysStorePrevious
 				&& lhs.ThreadSafe          == rhs.ThreadSafe
+				&& lhs.LockFreeRead        == rhs.LockFreeRead
+				&& lhs.StoreHistory        == rhs.StoreHistory
 			;
 		}
 
@@ -90,6 +116,10 @@ namespace Mcro::Observable
 
 	struct IStateTag {};
 
+	/** @brief Concept constraining values which can be stored in a `TState` with `LockFreeRead` policy */
+	template <typename T>
+	concept CLockFreeStateValue = std::is_trivially_copyable_v<T> && sizeof(T) <= MCRO_STATE_LOCK_FREE_READ_MAX_SIZE;
+
 	template <typename T>
 	inline constexpr FStatePolicy StatePolicyFor =
 		CClass<T>
@@ -180,6 +210,18 @@ namespace Mcro::Observable
 	template <typename T, FStatePolicy DefaultPolicy = StatePolicyFor<T>>
 	using TStateTS = TState<T, DefaultPolicy.With({.ThreadSafe = true})>;
 
+	/**
+	 *	@brief
+	 *	Convenience alias for thread safe states which can be read from any thread without locking, via
+	 *	`TState::GetSnapshot`. See `FStatePolicy::LockFreeRead`
+	 */
+	template <CLockFreeStateValue T, FStatePolicy DefaultPolicy = StatePolicyFor<T>>
+	using TStateLockFree = TState<T, DefaultPolicy.With({.ThreadSafe = true, .LockFreeRead = true})>;
+
+	/** @brief Convenience alias for states keeping the last N values. See `FStatePolicy::StoreHistory` */
+	template <typename T, int32 N, FStatePolicy DefaultPolicy = StatePolicyFor<T>>
+	using TStateWithHistory = TState<T, DefaultPolicy.With({.StoreHistory = N})>;
+
 	/** @brief Convenience alias for boolean states */
 	using FBool = TState<bool>;
 	
@@ -10,10 +10,17 @@
  */
 
 #pragma once
+
+#include <atomic>
+#include <new>
+
 #include "CoreMinimal.h"
+#include "Containers/StaticArray.h"
+#include "HAL/PlatformProcess.h"
 #include "Mcro/AssertMacros.h"
 #include "Mcro/Delegates/EventDelegate.h"
 #include "Mcro/Observable.Fwd.h"
+#include "Mcro/Threading.h"
 
 namespace Mcro::Observable
 {
@@ -52,13 +59,267 @@ namespace Mcro::Observable
 		TOptional<T> Previous;
 	};
 
+	/**
+	 *	@brief
+	 *	A scope lock of a state returned by value from `IState::ReadLock`, `IState::WriteLock` and
+	 *	`IState::GetOnAnyThread`. It only holds a lock when the state is thread-safe, otherwise it's an empty handle.
+	 *	It can be moved but not copied, the lock is released when the handle goes out of scope, or via `Release`.
+	 *
+	 *	@tparam Write  Lock for writing if true, lock for reading otherwise
+	 */
+	template <bool Write>
+	class TStateLock
+	{
+	public:
+		/** @brief An empty handle which doesn't lock anything */
+		TStateLock() = default;
+
+		explicit TStateLock(FRWLock& mutex) : Mutex(&mutex)
+		{
+			if constexpr (Write) Mutex->WriteLock();
+			else Mutex->ReadLock();
+		}
+
+		TStateLock(TStateLock const&) = delete;
+		TStateLock& operator = (TStateLock const&) = delete;
+
+		TStateLock(TStateLock&& other) noexcept : Mutex(other.Mutex)
+		{
+			other.Mutex = nullptr;
+		}
+
+		TStateLock& operator = (TStateLock&& other) noexcept
+		{
+			if (this != &other)
+			{
+				Release();
+				Mutex = other.Mutex;
+				other.Mutex = nullptr;
+			}
+			return *this;
+		}
+
+		~TStateLock() { Release(); }
+
+		/** @brief Unlock the state before the end of the scope */
+		void Release()
+		{
+			if (!Mutex) return;
+			if constexpr (Write) Mutex->WriteUnlock();
+			else Mutex->ReadUnlock();
+			Mutex = nullptr;
+		}
+
+		/** @brief Does this handle actually hold a lock (false when the state is not thread-safe) */
+		FORCEINLINE bool IsLocked() const { return Mutex != nullptr; }
+
+	private:
+		FRWLock* Mutex = nullptr;
+	};
+
+	using FStateReadLock = TStateLock<false>;
+	using FStateWriteLock = TStateLock<true>;
+
+	namespace Detail
+	{
+		/**
+		 *	Monotonically increasing change counter of a state. It's only incremented by the writer of the state, but
+		 *	it can be read from any thread without locking.
+		 */
+		class FStateVersion
+		{
+		public:
+			FStateVersion() = default;
+			FStateVersion(FStateVersion const& other) : Version(other.Get()) {}
+			FStateVersion& operator = (FStateVersion const& other)
+			{
+				Version.store(other.Get(), std::memory_order_release);
+				return *this;
+			}
+
+			FORCEINLINE uint64 Get() const { return Version.load(std::memory_order_acquire); }
+			FORCEINLINE void Increment() { Version.fetch_add(1, std::memory_order_acq_rel); }
+
+		private:
+			std::atomic<uint64> Version { 0 };
+		};
+
+		/** Type erased interface of states for `FStateBatch` */
+		struct IBatchedState
+		{
+			virtual ~IBatchedState() = default;
+			virtual void FlushBatch() = 0;
+		};
+
+		/** Work deferred until the outermost change notification on the current thread has finished */
+		struct IStateWaveListener
+		{
+			virtual ~IStateWaveListener() = default;
+			virtual void OnWaveEnd() = 0;
+		};
+
+		/** Minimal spin lock guarding short copies between a state and its mailboxes */
+		class FStateSpinLock
+		{
+		public:
+			void Lock()
+			{
+				while (bLocked.exchange(true, std::memory_order_acquire))
+				{
+					while (bLocked.load(std::memory_order_relaxed))
+						FPlatformProcess::YieldThread();
+				}
+			}
+
+			FORCEINLINE void Unlock() { bLocked.store(false, std::memory_order_release); }
+
+		private:
+			std::atomic<bool> bLocked { false };
+		};
+
+		/**
+		 *	Delivers state changes to a listener on a named thread, coalescing changes which happen before the
+		 *	listener had a chance to run. Only the latest value is kept, in a pending slot which is swapped with a
+		 *	delivering slot on the target thread. Both slots keep their storage between changes, so a value is only
+		 *	copy-assigned into existing storage per change (no allocations for collections which didn't grow). At most
+		 *	one task is queued on the target thread at a time, which is owned by `bQueued`.
+		 */
+		template <typename T>
+		class TStateMailbox : public TSharedFromThis<TStateMailbox<T>>
+		{
+		public:
+			TStateMailbox(ENamedThreads::Type thread, TDelegate<void(T const&)>&& deliver)
+				: Thread(thread)
+				, Deliver(MoveTemp(deliver))
+			{}
+
+			void Post(T const& value)
+			{
+				if (Threading::IsInThread(Thread))
+				{
+					// Values posted earlier from other threads are stale now. An already queued task will find nothing.
+					SlotLock.Lock();
+					bHasPending = false;
+					SlotLock.Unlock();
+					
+					Deliver.ExecuteIfBound(value);
+					return;
+				}
+
+				SlotLock.Lock();
+				if (Pending.IsSet()) Pending.GetValue() = value;
+				else Pending.Emplace(value);
+				bHasPending = true;
+				SlotLock.Unlock();
+				
+				// When a delivery is already queued it will pick up this value
+				if (bQueued.exchange(true, std::memory_order_acq_rel)) return;
+				
+				AsyncTask(Thread, [weakSelf = this->AsWeak()]
+				{
+					if (auto self = weakSelf.Pin()) self->Receive();
+				});
+			}
+
+		private:
+			void Receive()
+			{
+				// Posts after this point queue a new task, posts before it are picked up below
+				bQueued.store(false, std::memory_order_release);
+
+				SlotLock.Lock();
+				const bool hasValue = bHasPending;
+				if (hasValue) Swap(Pending, Delivering);
+				bHasPending = false;
+				SlotLock.Unlock();
+
+				if (hasValue) Deliver.ExecuteIfBound(Delivering.GetValue());
+			}
+
+			ENamedThreads::Type Thread;
+			TDelegate<void(T const&)> Deliver;
+			
+			FStateSpinLock SlotLock;
+			TOptional<T> Pending;
+			TOptional<T> Delivering;
+			bool bHasPending = false;
+			std::atomic<bool> bQueued { false };
+		};
+
+		/**
+		 *	A propagation wave is the outermost change notification of a state on the current thread, including every
+		 *	notification it triggers. Computed states defer their own notifications to the end of the wave, so they
+		 *	only recompute once all their changed dependencies have been invalidated.
+		 */
+		class MCRO_API FStateWave : public FNoncopyable
+		{
+		public:
+			FStateWave();
+			~FStateWave();
+
+			/** Run the given listener at the end of the current wave, or immediately if there's no wave going on */
+			static void Defer(IStateWaveListener& listener);
+
+			/** Used by listeners which are destroyed during a wave */
+			static void Forget(IStateWaveListener& listener);
+		};
+	}
+
+	/**
+	 *	@brief
+	 *	Collapse change notifications of states modified in the current scope. While a batch is active on the current
+	 *	thread, `TState::Set` and `TState::Modify` still store their values immediately, but their listeners are only
+	 *	notified once per state, with the final value, when the outermost batch ends (or when `Flush` is called).
+	 *
+	 *	States which end up equal to their value before the batch don't notify (if their value is equality comparable,
+	 *	unless `AlwaysNotify` policy is set or `Modify` was called with `alwaysNotify`). With `StorePrevious` policy
+	 *	the previous value of a state will be its value before the batch.
+	 *
+	 *	Batches are thread-local and they can be nested, nested batches are merged into the outermost one. Listeners
+	 *	modifying other states during the flush are also collapsed into the same batch.
+	 *
+	 *	States with `ThreadSafe` policy are not batched, they notify their listeners immediately even inside a batch.
+	 *	Version counters and the history of batched states only record the final value of the batch.
+	 *
+	 *	Usage:
+	 *	@code
+	 *	{
+	 *		FStateBatch batch;
+	 *		Width = 10;
+	 *		Height = 20;
+	 *		Width = 30;
+	 *	}
+	 *	// Listeners of Width are notified once with 30, listeners of Height are notified once with 20.
+	 *	@endcode
+	 */
+	class MCRO_API FStateBatch : public FNoncopyable
+	{
+	public:
+		FStateBatch();
+		~FStateBatch();
+
+		/** @brief The outermost batch active on the current thread, or nullptr if there's none */
+		static FStateBatch* GetCurrent();
+
+		/** @brief Notify listeners of the states changed so far, without ending the batch */
+		void Flush();
+
+		/** @brief Used by `TState` to defer its notifications until the end of the batch */
+		void Add(Detail::IBatchedState& state);
+
+		/** @brief Used by `TState` when it's destroyed during a batch */
+		void Forget(Detail::IBatchedState& state);
+
+	private:
+		FStateBatch* Outer = nullptr;
+		TArray<Detail::IBatchedState*, TInlineAllocator<16>> States;
+	};
+
 	/** @brief Public API and base class for `TState` which shouldn't concern with policy flags or thread safety */
 	template <typename T>
 	struct IState : IStateTag
 	{
 		using Type = T;
-		using ReadLockVariant = TVariant<FReadScopeLock, FVoid>;
-		using WriteLockVariant = TVariant<FWriteScopeLock, FVoid>;
 		
 		virtual ~IState() = default;
 		
@@ -142,6 +403,40 @@ namespace Mcro::Observable
 			return OnChange(InferDelegate::From(FWD(object), DelegateValueArgument(onChange)), eventPolicy);
 		}
 
+		/**
+		 *	@brief
+		 *	Add a listener which is called on the given named thread with the latest value of this state. Changes
+		 *	made on other threads are coalesced: while a delivery is pending on the target thread, further changes
+		 *	only replace the value it will carry, so the listener is called at most once per queued task, no matter
+		 *	how many times the state has changed in the meantime. Changes made on the target thread itself are
+		 *	delivered immediately.
+		 *
+		 *	The value is copied for the delivery, so T must be copyable. Changes made on other threads copy-assign the
+		 *	value into storage kept by the listener between deliveries, which still costs a full copy per change for
+		 *	large values (like collections), but not an allocation per change.
+		 *
+		 *	@param    thread  The named thread the listener should be called on
+		 *	@param    object  A lifespan guarding object, shared/weak pointer or UObject recommended.
+		 *	@param  onChange  `[](T const& next)`
+		 */
+		template <typename Object, CChangeNextOnlyListener<T> Function>
+		requires CCopyable<T>
+		FDelegateHandle OnChangeInThread(ENamedThreads::Type thread, Object&& object, Function const& onChange)
+		{
+			TDelegate<void(T const&)> deliver = InferDelegate::From(object, [onChange](T const& next) { onChange(next); });
+			auto mailbox = MakeShared<Detail::TStateMailbox<T>>(thread, MoveTemp(deliver));
+			return OnChange(FWD(object), [mailbox](T const& next) { mailbox->Post(next); });
+		}
+
+		/** @copydoc OnChangeInThread */
+		template <CChangeNextOnlyListener<T> Function>
+		requires CCopyable<T>
+		FDelegateHandle OnChangeInThread(ENamedThreads::Type thread, Function const& onChange)
+		{
+			auto mailbox = MakeShared<Detail::TStateMailbox<T>>(thread, InferDelegate::From([onChange](T const& next) { onChange(next); }));
+			return OnChange([mailbox](T const& next) { mailbox->Post(next); });
+		}
+
 		/**
 		 *	@brief  Pull changes from another state, syncing the value between the two. Values will be copied.
 		 *
@@ -199,6 +494,37 @@ namespace Mcro::Observable
 		/** @brief Returns true if this state has ever been changed from its initial value given at construction. */
 		virtual bool HasEverChanged() const = 0;
 
+		/**
+		 *	@brief
+		 *	The number of times this state has changed. It's incremented whenever a change is stored which would
+		 *	notify listeners, and it can be read from any thread. Use it to poll for changes (for example in ticks)
+		 *	without requiring the `StorePrevious` policy, so no copy of the previous value is made.
+		 */
+		virtual uint64 GetVersion() const = 0;
+
+		/** @brief Returns true if this state has changed since the given version was read via `GetVersion` */
+		FORCEINLINE bool HasChangedSince(uint64 version) const
+		{
+			return GetVersion() != version;
+		}
+
+		/**
+		 *	@brief
+		 *	Returns true if this state has changed since the version stored in `lastSeenVersion`, and updates that to
+		 *	the current version. Convenient for polling consumers which keep their last seen version as a member.
+		 *
+		 *	@code
+		 *	if (Resolution.ConsumeChange(LastResolutionVersion)) RecreateRenderTargets();
+		 *	@endcode
+		 */
+		FORCEINLINE bool ConsumeChange(uint64& lastSeenVersion) const
+		{
+			const uint64 current = GetVersion();
+			if (current == lastSeenVersion) return false;
+			lastSeenVersion = current;
+			return true;
+		}
+
 		/** @brief Equivalent to `TMulticastDelegate::Remove` */
 		virtual bool Remove(FDelegateHandle const& handle) = 0;
 		
@@ -220,28 +546,28 @@ namespace Mcro::Observable
 		 *	See https://godbolt.org/z/jn918fKfd
 		 *
 		 *	@return
-		 *	The lock is returned as TUniquePtr it's slightly more expensive because of ref-counting but it makes the API
-		 *	so much easier to use as TState can decide to return a real lock or just a dummy.
+		 *	The lock is returned by value without allocations. It's an empty handle when thread safety is not enabled.
+		 *	See `TStateLock`.
 		 */
-		virtual TTuple<T const&, TUniquePtr<ReadLockVariant>> GetOnAnyThread() const = 0;
+		virtual TTuple<T const&, FStateReadLock> GetOnAnyThread() const = 0;
 
 		/**
 		 *	@brief  Lock this state for reading for the current scope.
 		 *
 		 *	@return
-		 *	The lock is returned as TUniquePtr it's slightly more expensive because of ref-counting but it makes the API
-		 *	so much easier to use as TState can decide to return a real lock or just a dummy.
+		 *	The lock is returned by value without allocations. It's an empty handle when thread safety is not enabled.
+		 *	See `TStateLock`.
 		 */
-		virtual TUniquePtr<ReadLockVariant> ReadLock() const = 0;
+		virtual FStateReadLock ReadLock() const = 0;
 		
 		/**
 		 *	@brief  Lock this state for writing for the current scope.
 		 *	
 		 *	@return
-		 *	The lock is returned as TUniquePtr it's slightly more expensive because of ref-counting but it makes the API
-		 *	so much easier to use as TState can decide to return a real lock or just a dummy.
+		 *	The lock is returned by value without allocations. It's an empty handle when thread safety is not enabled.
+		 *	See `TStateLock`.
 		 */
-		virtual TUniquePtr<WriteLockVariant> WriteLock() = 0;
+		virtual FStateWriteLock WriteLock() = 0;
 
 		/** @brief Get the previous value if StorePrevious is enabled and there was at least one change */
 		virtual TOptional<T> const& GetPrevious() const = 0;
@@ -349,6 +675,177 @@ namespace Mcro::Observable
 		}
 	};
 
+	namespace Detail
+	{
+		/**
+		 *	A copy of a trivially copyable value guarded by a sequence lock. It supports one writer at a time, and any
+		 *	number of readers on any thread, which never block the writer. The value is stored in atomic words, so
+		 *	readers racing with the writer are well-defined, they just retry.
+		 */
+		template <typename T>
+		class TSeqLockValue
+		{
+			static_assert(CLockFreeStateValue<T>);
+			static constexpr int32 WordCount = (sizeof(T) + sizeof(uint64) - 1) / sizeof(uint64);
+
+			std::atomic<uint32> Sequence { 0 };
+			std::atomic<uint64> Words[WordCount];
+			
+		public:
+			explicit TSeqLockValue(T const& value) { Store(value); }
+			TSeqLockValue(TSeqLockValue const& other) { Store(other.Load()); }
+			TSeqLockValue& operator = (TSeqLockValue const& other) { Store(other.Load()); return *this; }
+
+			/** Writers must be synchronized externally */
+			void Store(T const& value)
+			{
+				uint64 words[WordCount] {};
+				FMemory::Memcpy(words, &value, sizeof(T));
+
+				const uint32 sequence = Sequence.load(std::memory_order_relaxed);
+				Sequence.store(sequence + 1, std::memory_order_relaxed);
+				std::atomic_thread_fence(std::memory_order_release);
+				
+				for (int32 i = 0; i < WordCount; ++i)
+					Words[i].store(words[i], std::memory_order_relaxed);
+				
+				Sequence.store(sequence + 2, std::memory_order_release);
+			}
+
+			T Load() const
+			{
+				uint64 words[WordCount];
+				for (;;)
+				{
+					const uint32 begin = Sequence.load(std::memory_order_acquire);
+					if (begin & 1)
+					{
+						FPlatformProcess::SleepNoStats(0.0f);
+						continue;
+					}
+					
+					for (int32 i = 0; i < WordCount; ++i)
+						words[i] = Words[i].load(std::memory_order_relaxed);
+					
+					std::atomic_thread_fence(std::memory_order_acquire);
+					if (Sequence.load(std::memory_order_relaxed) == begin) break;
+				}
+				
+				alignas(T) uint8 bytes[sizeof(T)];
+				FMemory::Memcpy(bytes, words, sizeof(T));
+				return *std::launder(reinterpret_cast<T*>(bytes));
+			}
+		};
+	}
+
+	/**
+	 *	@brief
+	 *	A view over the history of a state with `StoreHistory` policy, ordered from the current value (at index 0)
+	 *	to the oldest value kept. It's a random access range, so it can be iterated, indexed, and used with range-v3
+	 *	views. The view is only valid until the state changes.
+	 */
+	template <typename T>
+	class TStateHistoryView
+	{
+	public:
+		class FIterator
+		{
+		public:
+			using value_type        = T;
+			using difference_type   = int32;
+			using pointer           = const T*;
+			using reference         = T const&;
+			using iterator_category = std::random_access_iterator_tag;
+			using iterator_concept  = std::random_access_iterator_tag;
+
+			FIterator() = default;
+			FIterator(TStateHistoryView const* view, int32 age) : Data(view->Data), Capacity(view->Capacity), Head(view->Head), Age(age) {}
+
+			T const& operator * () const { return Data[(Head - Age + Capacity) % Capacity]; }
+			const T* operator -> () const { return &**this; }
+			T const& operator [] (int32 offset) const { return *(*this + offset); }
+
+			FIterator& operator ++ () { ++Age; return *this; }
+			FIterator& operator -- () { --Age; return *this; }
+			FIterator operator ++ (int) { FIterator previous = *this; ++Age; return previous; }
+			FIterator operator -- (int) { FIterator previous = *this; --Age; return previous; }
+			FIterator& operator += (int32 steps) { Age += steps; return *this; }
+			FIterator& operator -= (int32 steps) { Age -= steps; return *this; }
+			FIterator operator + (int32 steps) const { FIterator result = *this; return result += steps; }
+			FIterator operator - (int32 steps) const { FIterator result = *this; return result -= steps; }
+			friend FIterator operator + (int32 steps, FIterator const& iterator) { return iterator + steps; }
+			int32 operator - (FIterator const& other) const { return Age - other.Age; }
+
+			bool operator == (FIterator const& other) const { return Age == other.Age; }
+			auto operator <=> (FIterator const& other) const { return Age <=> other.Age; }
+
+		private:
+			const T* Data = nullptr;
+			int32 Capacity = 1;
+			int32 Head = 0;
+			int32 Age = 0;
+		};
+
+		TStateHistoryView(const T* data, int32 capacity, int32 head, int32 num)
+			: Data(data), Capacity(capacity), Head(head), Count(num)
+		{}
+
+		FORCEINLINE int32 Num() const { return Count; }
+		FORCEINLINE bool IsEmpty() const { return Count == 0; }
+		FORCEINLINE bool IsValidIndex(int32 age) const { return age >= 0 && age < Count; }
+
+		/** @brief Get a value by its age, 0 is the current value, 1 is the previous one and so on */
+		T const& operator [] (int32 age) const
+		{
+			check(IsValidIndex(age));
+			return Data[(Head - age + Capacity) % Capacity];
+		}
+
+		/** @brief The oldest value kept in the history */
+		T const& Oldest() const { return (*this)[Count - 1]; }
+
+		FIterator begin() const { return FIterator(this, 0); }
+		FIterator end() const { return FIterator(this, Count); }
+
+	private:
+		const T* Data;
+		int32 Capacity;
+		int32 Head;
+		int32 Count;
+	};
+
+	namespace Detail
+	{
+		/** Preallocated ring buffer of the last values of a state, see `FStatePolicy::StoreHistory` */
+		template <typename T, int32 Capacity>
+		class TStateHistory
+		{
+			static_assert(CDefaultInitializable<T> && CCopyable<T>,
+				"StoreHistory policy is only available for default initializable and copyable values."
+			);
+
+		public:
+			explicit TStateHistory(T const& initial) { Push(initial); }
+
+			void Push(T const& value)
+			{
+				Head = (Head + 1) % Capacity;
+				Values[Head] = value;
+				Count = FMath::Min(Count + 1, Capacity);
+			}
+
+			TStateHistoryView<T> View() const
+			{
+				return { Values.GetData(), Capacity, Head, Count };
+			}
+
+		private:
+			TStaticArray<T, Capacity> Values;
+			int32 Head = Capacity - 1;
+			int32 Count = 0;
+		};
+	}
+
 	/**
 	 *	@brief 
 	 *	Storage wrapper for any value which state needs to be tracked or their change needs to be observed.
@@ -370,20 +867,22 @@ namespace Mcro::Observable
 	 *	determined by `StatePolicyFor` template for any given type.
 	 */
 	template <typename T, FStatePolicy DefaultPolicy>
-	struct TState : IState<T>
+	struct TState : IState<T>, Detail::IBatchedState
 	{
 		template <typename ThreadSafeType, typename NaiveType>
 		using ThreadSafeSwitch = std::conditional_t<DefaultPolicy.ThreadSafe, ThreadSafeType, NaiveType>;
 		
 		using StateBase = IState<T>;
-
-		using typename StateBase::ReadLockVariant;
-		using typename StateBase::WriteLockVariant;
 		
 		using ReadLockType = ThreadSafeSwitch<FReadScopeLock, FVoid>;
 		using WriteLockType = ThreadSafeSwitch<FWriteScopeLock, FVoid>;
 		
 		static constexpr FStatePolicy DefaultPolicyFlags = DefaultPolicy;
+
+		static_assert(!DefaultPolicy.LockFreeRead || CLockFreeStateValue<T>,
+			"LockFreeRead policy is only available for small trivially copyable values. See CLockFreeStateValue"
+		);
+		static_assert(DefaultPolicy.StoreHistory >= 0, "StoreHistory policy cannot be negative");
 		
 		/** @brief Enable default constructor only when T is default initializable */
 		template <CDefaultInitializable = T>
@@ -414,21 +913,45 @@ namespace Mcro::Observable
 		template <typename... Args>
 		requires (sizeof...(Args) > 1)
 		TState(Args&&... args) : Value(FWD(args)...) {}
+
+		virtual ~TState() override
+		{
+			if (BatchOwner) BatchOwner->Forget(*this);
+		}
 		
 		virtual T const& Get() const override { return Value.Next; }
 		
-		virtual TTuple<T const&, TUniquePtr<ReadLockVariant>> GetOnAnyThread() const override
+		virtual TTuple<T const&, FStateReadLock> GetOnAnyThread() const override
 		{
 			return { Value.Next, ReadLock() };
 		}
+
+		/**
+		 *	@brief
+		 *	Get a consistent copy of the current value on any thread. With `LockFreeRead` policy this doesn't take any
+		 *	locks, otherwise the value is copied under a read lock (when thread safety is enabled).
+		 */
+		template <CCopyConstructible = T>
+		T GetSnapshot() const
+		{
+			if constexpr (DefaultPolicy.LockFreeRead) return Snapshot.Load();
+			else
+			{
+				auto lock = ReadLock();
+				return Value.Next;
+			}
+		}
 		
 		virtual void Set(T const& value) override
 		{
 			ASSERT_QUIT(!Modifying, ,
 				->WithMessage(TEXT_"Attempting to set this state while this state is already being set from somewhere else.")
 			);
+			// The wave ends after the lock is released, so deferred listeners can subscribe to or read this state
+			Detail::FStateWave wave;
 			TGuardValue modifyingGuard(Modifying, true);
-			auto lock = WriteLock();
+			auto lock = ScopeWriteLock();
+			const bool batched = BeginBatchedChange();
 			bool allow = true;
 
 			if constexpr (CCoreEqualityComparable<T>)
@@ -441,7 +964,13 @@ namespace Mcro::Observable
 			if (allow)
 			{
 				Value.Next = value;
-				OnChangeEvent.Broadcast(Value);
+				UpdateSnapshot();
+				if (batched) bBatchPending = true;
+				else
+				{
+					CommitChange();
+					Broadcast();
+				}
 			}
 		}
 		
@@ -450,8 +979,11 @@ namespace Mcro::Observable
 			ASSERT_QUIT(!Modifying, ,
 				->WithMessage(TEXT_"Attempting to set this state while this state is already being set from somewhere else.")
 			);
+			// The wave ends after the lock is released, so deferred listeners can subscribe to or read this state
+			Detail::FStateWave wave;
 			TGuardValue modifyingGuard(Modifying, true);
-			auto lock = WriteLock();
+			auto lock = ScopeWriteLock();
+			const bool batched = BeginBatchedChange();
 			bool allow = true;
 			TOptional<T> previous;
 			
@@ -460,6 +992,7 @@ namespace Mcro::Observable
 				previous = Value.Next;
 			
 			modifier(Value.Next);
+			UpdateSnapshot();
 
 			if constexpr (CCopyable<T> && CCoreEqualityComparable<T>)
 				allow = alwaysNotify
@@ -470,28 +1003,36 @@ namespace Mcro::Observable
 			if constexpr (CCopyable<T>)
 			if (PolicyFlags.StorePrevious && (allow || PolicyFlags.AlwaysStorePrevious))
 				Value.Previous = previous;
-			
-			if (allow)
-				OnChangeEvent.Broadcast(Value);
+
+			if (allow && batched)
+			{
+				bBatchPending = true;
+				bBatchForceNotify |= alwaysNotify;
+			}
+			else if (allow)
+			{
+				CommitChange();
+				Broadcast();
+			}
 		}
 
 	protected:
 		virtual FDelegateHandle OnChangeImpl(TDelegate<void(TChangeData<T> const&)>&& onChange, FEventPolicy const& eventPolicy = {}) override
 		{
-			auto lock = WriteLock();
+			auto lock = ScopeWriteLock();
 			return OnChangeEvent.Add(onChange, eventPolicy);
 		}
 
 	public:
 		virtual bool Remove(FDelegateHandle const& handle) override
 		{
-			auto lock = WriteLock();
+			auto lock = ScopeWriteLock();
 			return OnChangeEvent.Remove(handle);
 		}
 
 		virtual int32 RemoveAll(const void* object) override
 		{
-			auto lock = WriteLock();
+			auto lock = ScopeWriteLock();
 			return OnChangeEvent.RemoveAll(object);
 		}
 
@@ -514,15 +1055,34 @@ namespace Mcro::Observable
 		{
 			return OnChangeEvent.IsBroadcasted();
 		}
+
+		virtual uint64 GetVersion() const override
+		{
+			return Version.Get();
+		}
+
+		/**
+		 *	@brief
+		 *	Get the last values of this state from the current one to the oldest. Only available with `StoreHistory`
+		 *	policy. Thread safety is not considered in this function, use `ReadLock` while using the returned view if
+		 *	thread safety is a concern.
+		 */
+		TStateHistoryView<T> GetHistory() const
+		requires (DefaultPolicy.StoreHistory > 0)
+		{
+			return History.View();
+		}
 		
-		virtual TUniquePtr<ReadLockVariant> ReadLock() const override
+		virtual FStateReadLock ReadLock() const override
 		{
-			return MakeUnique<ReadLockVariant>(TInPlaceType<ReadLockType>(), Mutex.Get());
+			if constexpr (DefaultPolicy.ThreadSafe) return FStateReadLock(Mutex.Get());
+			else return {};
 		}
 		
-		virtual TUniquePtr<WriteLockVariant> WriteLock() override
+		virtual FStateWriteLock WriteLock() override
 		{
-			return MakeUnique<WriteLockVariant>(TInPlaceType<WriteLockType>(), Mutex.Get());
+			if constexpr (DefaultPolicy.ThreadSafe) return FStateWriteLock(Mutex.Get());
+			else return {};
 		}
 
 		virtual TOptional<T> const& GetPrevious() const override
@@ -547,7 +1107,7 @@ namespace Mcro::Observable
 				->WithMessage(TEXT_"Attempting to set this state while this state is already being set from somewhere else.")
 			);
 			TGuardValue modifyingGuard(Modifying, true);
-			auto lock = WriteLock();
+			auto lock = ScopeWriteLock();
 			Value.Previous = Value.Next;
 		}
 		
@@ -565,10 +1125,115 @@ namespace Mcro::Observable
 		FStatePolicy PolicyFlags { DefaultPolicy };
 		
 	private:
-		TEventDelegate<void(TChangeData<T> const&)> OnChangeEvent;
+		virtual void FlushBatch() override
+		{
+			ASSERT_QUIT(!Modifying, ,
+				->WithMessage(TEXT_"Attempting to flush a batch while this state is being set from somewhere else.")
+			);
+			// The wave ends after the lock is released, see `Set`
+			Detail::FStateWave wave;
+			TGuardValue modifyingGuard(Modifying, true);
+			auto lock = ScopeWriteLock();
+			
+			BatchOwner = nullptr;
+			if (!bBatchPending) return;
+			bBatchPending = false;
+			
+			bool notify = true;
+			if constexpr (CCopyable<T>)
+			{
+				FBatchOrigin const& origin = BatchOrigin.GetValue();
+				if constexpr (CCoreEqualityComparable<T>)
+					notify = bBatchForceNotify || PolicyFlags.AlwaysNotify || origin.Next != Value.Next;
+				
+				if (PolicyFlags.StorePrevious)
+				{
+					if (notify || PolicyFlags.AlwaysStorePrevious)
+						Value.Previous = origin.Next;
+					else
+						Value.Previous = origin.Previous;
+				}
+				BatchOrigin.Reset();
+			}
+			bBatchForceNotify = false;
+			
+			if (notify)
+			{
+				// Intermediate values of the batch are not committed to the version or the history
+				CommitChange();
+				Broadcast();
+			}
+		}
+
+		/** Only call this within an `FStateWave` opened before the write lock was taken */
+		void Broadcast()
+		{
+			OnChangeEvent.Broadcast(Value);
+		}
+
+		/**
+		 *	Join the batch active on the current thread if there's one, before the value is changed. Batches are
+		 *	thread-local, but a thread-safe state may be modified from multiple threads, so thread-safe states don't
+		 *	take part in batches and always notify immediately.
+		 */
+		bool BeginBatchedChange()
+		{
+			if constexpr (DefaultPolicy.ThreadSafe) return false;
+			
+			FStateBatch* batch = FStateBatch::GetCurrent();
+			if (!batch) return false;
+			if (BatchOwner == batch) return true;
+			
+			BatchOwner = batch;
+			if constexpr (CCopyable<T>)
+				BatchOrigin.Emplace(FBatchOrigin { Value.Next, Value.Previous });
+			batch->Add(*this);
+			return true;
+		}
+		
+		/** Non-virtual scope lock for internal use, which compiles to nothing when thread safety is not enabled */
+		FORCEINLINE WriteLockType ScopeWriteLock()
+		{
+			if constexpr (DefaultPolicy.ThreadSafe) return WriteLockType(Mutex.Get());
+			else return {};
+		}
+		
+		/** Called after a change which notifies listeners was stored */
+		FORCEINLINE void CommitChange()
+		{
+			Version.Increment();
+			if constexpr (DefaultPolicy.StoreHistory > 0) History.Push(Value.Next);
+		}
+
+		FORCEINLINE void UpdateSnapshot()
+		{
+			if constexpr (DefaultPolicy.LockFreeRead) Snapshot.Store(Value.Next);
+		}
+		
+		/** Most states have only a couple of listeners, those shouldn't allocate a listener list for each state */
+		TEventDelegate<void(TChangeData<T> const&), {.InlineListeners = 2}> OnChangeEvent;
 		TChangeData<T> Value;
+		Detail::FStateVersion Version;
+		std::conditional_t<
+			(DefaultPolicy.StoreHistory > 0),
+			Detail::TStateHistory<T, DefaultPolicy.StoreHistory>,
+			FVoid
+		> History { Value.Next };
+		std::conditional_t<DefaultPolicy.LockFreeRead, Detail::TSeqLockValue<T>, FVoid> Snapshot { Value.Next };
 		bool Modifying = false;
-		mutable TInitializeOnCopy<FRWLock> Mutex;
+
+		/** The value of this state before the current batch */
+		struct FBatchOrigin
+		{
+			T Next;
+			TOptional<T> Previous;
+		};
+
+		FStateBatch* BatchOwner = nullptr;
+		std::conditional_t<CCopyable<T>, TOptional<FBatchOrigin>, FVoid> BatchOrigin;
+		bool bBatchPending = false;
+		bool bBatchForceNotify = false;
+		mutable ThreadSafeSwitch<TInitializeOnCopy<FRWLock>, FVoid> Mutex;
 	};
 
 	template <typename LeftValue, CWeaklyEqualityComparableWith<LeftValue> RightValue>
@@ -0,0 +1,408 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Mcro/Observable.h"
+
+namespace Mcro::Observable
+{
+	/** @brief The kind of operation which changed an array state */
+	enum class EArrayStateChange : uint8
+	{
+		/** `Count` items were inserted starting at `Index` */
+		Insert,
+
+		/** `Count` items were removed starting at `Index` */
+		Remove,
+
+		/** The item at `Index` was modified in place */
+		Update,
+
+		/** The item at `Index` was moved to `To` (which is its index after the move) */
+		Move,
+
+		/** The entire array was replaced, listeners should treat it as a new snapshot */
+		Reset
+	};
+
+	/** @brief A single change of an array state, see `TArrayState` */
+	struct FArrayStateChange
+	{
+		EArrayStateChange Kind = EArrayStateChange::Reset;
+		int32 Index = INDEX_NONE;
+		int32 Count = 0;
+		int32 To = INDEX_NONE;
+	};
+
+	/** @brief The kind of operation which changed a map state */
+	enum class EMapStateChange : uint8
+	{
+		/** A new key was added */
+		Add,
+
+		/** A key was removed */
+		Remove,
+
+		/** The value of an existing key was modified */
+		Update,
+
+		/** The entire map was replaced, listeners should treat it as a new snapshot */
+		Reset
+	};
+
+	/**
+	 *	@brief
+	 *	A single change of a map state, see `TMapState`. `Key` points to the affected key, it's only valid for the
+	 *	duration of the notification, and it's nullptr for `Reset`.
+	 */
+	template <typename K>
+	struct TMapStateChange
+	{
+		EMapStateChange Kind = EMapStateChange::Reset;
+		K const* Key = nullptr;
+	};
+
+	namespace Detail
+	{
+		/**
+		 *	Common part of collection states. It implements `IState` for the whole collection, so collection states
+		 *	can be used where a state of the collection type is expected, and it manages the delta listeners.
+		 */
+		template <typename Collection, typename Change>
+		class TCollectionState : public IState<Collection>
+		{
+		public:
+			using FDeltaDelegate = TDelegate<void(Collection const&, Change const&)>;
+
+			TCollectionState() = default;
+			explicit TCollectionState(Collection const& value) : Value(value) {}
+			explicit TCollectionState(Collection&& value) : Value(MoveTemp(value)) {}
+
+			TCollectionState(TCollectionState const&) = delete;
+			TCollectionState& operator = (TCollectionState const&) = delete;
+
+			/**
+			 *	@brief
+			 *	Add a delegate which is notified about each individual change of this collection, with the collection
+			 *	already modified.
+			 *
+			 *	Delta listeners cannot be belated, as changes are not retained after their notification.
+			 */
+			FDelegateHandle OnDelta(FDeltaDelegate onDelta, FEventPolicy const& eventPolicy = {})
+			{
+				ASSERT_CRASH(!eventPolicy.Belated,
+					->WithMessage(TEXT_"Delta listeners of collection states cannot be belated.")
+				);
+				return OnDeltaEvent.Add(MoveTemp(onDelta), eventPolicy);
+			}
+
+			/** @brief Add a function without object binding with signature `[](Collection const&, Change const&)` */
+			template <typename Function>
+			requires std::is_invocable_v<Function, Collection const&, Change const&>
+			FDelegateHandle OnDelta(Function const& onDelta, FEventPolicy const& eventPolicy = {})
+			{
+				return OnDelta(InferDelegate::From(onDelta), eventPolicy);
+			}
+
+			/** @brief Add a function with an object binding with signature `[](Collection const&, Change const&)` */
+			template <typename Object, typename Function>
+			requires std::is_invocable_v<Function, Collection const&, Change const&>
+			FDelegateHandle OnDelta(Object&& object, Function const& onDelta, FEventPolicy const& eventPolicy = {})
+			{
+				return OnDelta(InferDelegate::From(FWD(object), onDelta), eventPolicy);
+			}
+
+			FORCEINLINE int32 Num() const { return Value.Next.Num(); }
+			FORCEINLINE bool IsEmpty() const { return Value.Next.IsEmpty(); }
+
+			/** @brief Replace the entire collection, which is notified as a reset */
+			void Reset(Collection&& value)
+			{
+				Value.Next = MoveTemp(value);
+				bEverChanged = true;
+				Notify(Change {});
+			}
+
+			/** @brief Remove all items of the collection, which is notified as a reset */
+			void Empty()
+			{
+				Reset({});
+			}
+
+			virtual Collection const& Get() const override { return Value.Next; }
+
+			virtual void Set(Collection const& value) override
+			{
+				Reset(CopyTemp(value));
+			}
+
+			/** @brief Modifying the entire collection is notified as a reset */
+			virtual void Modify(TUniqueFunction<void(Collection&)>&& modifier, bool alwaysNotify = true) override
+			{
+				modifier(Value.Next);
+				bEverChanged = true;
+				Notify(Change {});
+			}
+
+			virtual bool HasChangedFrom(Collection const& nextValue) override
+			{
+				if constexpr (CCoreEqualityComparable<Collection>)
+				{
+					if (Value.Next == nextValue) return false;
+				}
+				Set(nextValue);
+				return true;
+			}
+
+			virtual bool HasEverChanged() const override { return bEverChanged; }
+			virtual uint64 GetVersion() const override { return Version.Get(); }
+
+			virtual bool Remove(FDelegateHandle const& handle) override
+			{
+				return OnChangeEvent.Remove(handle) || OnDeltaEvent.Remove(handle);
+			}
+
+			virtual int32 RemoveAll(const void* object) override
+			{
+				return OnChangeEvent.RemoveAll(object) + OnDeltaEvent.RemoveAll(object);
+			}
+
+			virtual TTuple<Collection const&, FStateReadLock> GetOnAnyThread() const override { return { Value.Next, {} }; }
+			virtual FStateReadLock ReadLock() const override { return {}; }
+			virtual FStateWriteLock WriteLock() override { return {}; }
+
+			/** Collection states don't store previous values, as their listeners are notified about the changes */
+			virtual TOptional<Collection> const& GetPrevious() const override { return Value.Previous; }
+			virtual Collection const& GetPrevious(Collection const& fallback) const override { return fallback; }
+			virtual Collection const& GetPreviousOrCurrent() const override { return Value.Next; }
+			virtual void NormalizePrevious() override {}
+
+		protected:
+			virtual FDelegateHandle OnChangeImpl(TDelegate<void(TChangeData<Collection> const&)>&& onChange, FEventPolicy const& eventPolicy = {}) override
+			{
+				return OnChangeEvent.Add(onChange, eventPolicy);
+			}
+
+			/** Notify delta listeners about a single change, then snapshot listeners (if there are any) */
+			void Notify(Change const& change)
+			{
+				Version.Increment();
+				Detail::FStateWave wave;
+				OnDeltaEvent.Broadcast(Value.Next, change);
+				if (OnChangeEvent.IsBound()) OnChangeEvent.Broadcast(Value);
+			}
+
+			TChangeData<Collection> Value;
+			bool bEverChanged = false;
+
+		private:
+			TEventDelegate<void(TChangeData<Collection> const&)> OnChangeEvent;
+			TEventDelegate<void(Collection const&, Change const&)> OnDeltaEvent;
+			FStateVersion Version;
+		};
+	}
+
+	/**
+	 *	@brief
+	 *	An array state which notifies its listeners about individual insertions, removals, updates and moves, instead
+	 *	of only the entire array after each change. Delta listeners (added via `OnDelta`) receive the array after the
+	 *	change, and an `FArrayStateChange` describing it, so they can update their own data in proportion to the
+	 *	change, not to the size of the array.
+	 *
+	 *	It's also an `IState<TArray<T>>`, so it can be used with API expecting array states. Listeners added via
+	 *	`OnChange` are notified with the entire array after each change. Replacing the array via `Set`, `Modify` or
+	 *	`Reset` is notified as an `EArrayStateChange::Reset`.
+	 *
+	 *	Usage:
+	 *	@code
+	 *	TArrayState<FString> Names;
+	 *	Names.OnDelta([](TArray<FString> const& names, FArrayStateChange const& change)
+	 *	{
+	 *		if (change.Kind == EArrayStateChange::Insert) { ... }
+	 *	});
+	 *	Names.Add(TEXT_"Alice");
+	 *	Names.Update(0, [](FString& name) { name = TEXT_"Bob"; });
+	 *	@endcode
+	 *
+	 *	@warning
+	 *	Collection states are not thread-safe, and their changes are notified immediately, even within an
+	 *	`FStateBatch`. Modifying the collection from within its listeners is prohibited.
+	 *
+	 *	@tparam T  The type of the items
+	 */
+	template <typename T>
+	class TArrayState : public Detail::TCollectionState<TArray<T>, FArrayStateChange>
+	{
+		using Super = Detail::TCollectionState<TArray<T>, FArrayStateChange>;
+
+	public:
+		using Super::Super;
+
+		FORCEINLINE T const& operator [] (int32 index) const { return Super::Value.Next[index]; }
+
+		/** @brief Insert an item at the given index */
+		template <typename Arg>
+		requires std::is_constructible_v<T, Arg>
+		void Insert(Arg&& item, int32 index)
+		{
+			Super::Value.Next.Insert(FWD(item), index);
+			Notify(EArrayStateChange::Insert, index, 1);
+		}
+
+		/** @brief Insert multiple items starting at the given index, notified as one change */
+		void Insert(TArrayView<const T> items, int32 index)
+		{
+			if (items.IsEmpty()) return;
+			Super::Value.Next.Insert(items.GetData(), items.Num(), index);
+			Notify(EArrayStateChange::Insert, index, items.Num());
+		}
+
+		/** @brief Add an item to the end of the array */
+		template <typename Arg>
+		requires std::is_constructible_v<T, Arg>
+		int32 Add(Arg&& item)
+		{
+			const int32 index = Super::Value.Next.Add(FWD(item));
+			Notify(EArrayStateChange::Insert, index, 1);
+			return index;
+		}
+
+		/** @brief Add multiple items to the end of the array, notified as one change */
+		void Append(TArrayView<const T> items)
+		{
+			Insert(items, Super::Value.Next.Num());
+		}
+
+		/** @brief Remove `count` items starting at the given index */
+		void RemoveAt(int32 index, int32 count = 1)
+		{
+			if (count <= 0) return;
+			Super::Value.Next.RemoveAt(index, count);
+			Notify(EArrayStateChange::Remove, index, count);
+		}
+
+		/** @brief Replace the item at the given index */
+		template <typename Arg>
+		requires std::is_assignable_v<T&, Arg>
+		void Update(int32 index, Arg&& item)
+		{
+			Super::Value.Next[index] = FWD(item);
+			Notify(EArrayStateChange::Update, index, 1);
+		}
+
+		/** @brief Modify the item at the given index in place */
+		template <typename Function>
+		requires std::is_invocable_v<Function, T&>
+		void Update(int32 index, Function&& modifier)
+		{
+			modifier(Super::Value.Next[index]);
+			Notify(EArrayStateChange::Update, index, 1);
+		}
+
+		/**
+		 *	@brief  Move an item to another position, shifting the items between them.
+		 *	@param from  The current index of the item
+		 *	@param   to  The index of the item after the move
+		 */
+		void Move(int32 from, int32 to)
+		{
+			if (from == to) return;
+			TArray<T>& items = Super::Value.Next;
+			T moving = MoveTemp(items[from]);
+			items.RemoveAt(from);
+			items.Insert(MoveTemp(moving), to);
+			Super::bEverChanged = true;
+			Super::Notify({ .Kind = EArrayStateChange::Move, .Index = from, .Count = 1, .To = to });
+		}
+
+	private:
+		void Notify(EArrayStateChange kind, int32 index, int32 count)
+		{
+			Super::bEverChanged = true;
+			Super::Notify({ .Kind = kind, .Index = index, .Count = count });
+		}
+	};
+
+	/**
+	 *	@brief
+	 *	A map state which notifies its listeners about individual additions, removals and updates of keys, instead
+	 *	of only the entire map after each change. Delta listeners (added via `OnDelta`) receive the map after the
+	 *	change, and a `TMapStateChange` describing it.
+	 *
+	 *	It's also an `IState<TMap<K, V>>`, so it can be used with API expecting map states. Listeners added via
+	 *	`OnChange` are notified with the entire map after each change. Replacing the map via `Set`, `Modify` or
+	 *	`Reset` is notified as an `EMapStateChange::Reset`.
+	 *
+	 *	@warning
+	 *	Collection states are not thread-safe, and their changes are notified immediately, even within an
+	 *	`FStateBatch`. Modifying the collection from within its listeners is prohibited.
+	 *
+	 *	@tparam K  The type of the keys
+	 *	@tparam V  The type of the values
+	 */
+	template <typename K, typename V>
+	class TMapState : public Detail::TCollectionState<TMap<K, V>, TMapStateChange<K>>
+	{
+		using Super = Detail::TCollectionState<TMap<K, V>, TMapStateChange<K>>;
+
+	public:
+		using Super::Super;
+
+		FORCEINLINE V const* Find(K const& key) const { return Super::Value.Next.Find(key); }
+		FORCEINLINE bool Contains(K const& key) const { return Super::Value.Next.Contains(key); }
+
+		/** @brief Add a new key or replace the value of an existing one, notified as `Add` or `Update` respectively */
+		template <typename Arg>
+		void Add(K const& key, Arg&& value)
+		{
+			TMap<K, V>& map = Super::Value.Next;
+			if (V* existing = map.Find(key))
+			{
+				*existing = FWD(value);
+				Notify(EMapStateChange::Update, key);
+				return;
+			}
+			map.Add(key, FWD(value));
+			Notify(EMapStateChange::Add, key);
+		}
+
+		/** @brief Modify the value of an existing key in place. Returns false if the key was not present. */
+		template <typename Function>
+		requires std::is_invocable_v<Function, V&>
+		bool Update(K const& key, Function&& modifier)
+		{
+			V* existing = Super::Value.Next.Find(key);
+			if (!existing) return false;
+			modifier(*existing);
+			Notify(EMapStateChange::Update, key);
+			return true;
+		}
+
+		/** @brief Remove a key. Returns false if the key was not present. */
+		bool Remove(K const& key)
+		{
+			if (!Super::Value.Next.Remove(key)) return false;
+			Notify(EMapStateChange::Remove, key);
+			return true;
+		}
+
+		using Super::Remove;
+
+	private:
+		void Notify(EMapStateChange kind, K const& key)
+		{
+			Super::bEverChanged = true;
+			Super::Notify({ .Kind = kind, .Key = &key });
+		}
+	};
+}
@@ -0,0 +1,310 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Mcro/Observable.h"
+
+namespace Mcro::Observable
+{
+	template <typename T>
+	class TComputedState;
+
+	class FComputeContext;
+
+	namespace Detail
+	{
+		/** Non-template part of computed states, maintaining the dependency graph between them */
+		class MCRO_API FComputedNode : public IStateWaveListener
+		{
+		public:
+			FComputedNode() = default;
+			FComputedNode(FComputedNode const&) = delete;
+			FComputedNode& operator = (FComputedNode const&) = delete;
+			virtual ~FComputedNode() override;
+
+			/**
+			 *	Invalidate the cached value of this node and every node depending on it. Nodes which have listeners
+			 *	are recomputed at the end of the current propagation wave.
+			 */
+			void MarkDirty();
+
+			FORCEINLINE bool IsDirty() const { return bDirty; }
+
+		protected:
+			friend class Mcro::Observable::FComputeContext;
+
+			virtual bool HasListeners() const = 0;
+
+			/** Call before computing the value, so dependencies which are no longer read can be dropped */
+			void BeginTracking();
+
+			/** Call after computing the value to drop dependencies which were not read */
+			void EndTracking();
+
+			void TrackNode(FComputedNode& upstream);
+
+			template <typename V>
+			void TrackSource(IState<V> const& source)
+			{
+				if (MarkSeen(&source)) return;
+
+				IState<V>& mutableSource = const_cast<IState<V>&>(source);
+				const FDelegateHandle handle = mutableSource.OnChange([this](V const&) { MarkDirty(); });
+				AddDependency({
+					.Key = &source,
+					.Unsubscribe = [&mutableSource, handle] { mutableSource.Remove(handle); }
+				});
+			}
+
+			bool bDirty = true;
+
+		private:
+			struct FDependency
+			{
+				const void* Key = nullptr;
+				FComputedNode* Node = nullptr;
+				TFunction<void()> Unsubscribe;
+				bool bSeen = true;
+			};
+
+			bool MarkSeen(const void* key);
+			void AddDependency(FDependency&& dependency);
+			void Unlink(FDependency& dependency);
+
+			TArray<FDependency, TInlineAllocator<4>> Dependencies;
+			TArray<FComputedNode*, TInlineAllocator<4>> Dependents;
+		};
+	}
+
+	/**
+	 *	@brief
+	 *	Passed to the function of `TComputedState`. States read through it are tracked as dependencies of the
+	 *	computed state, so it's invalidated when any of them changes.
+	 */
+	class FComputeContext : public FNoncopyable
+	{
+	public:
+		explicit FComputeContext(Detail::FComputedNode& node) : Node(node) {}
+
+		/** @brief Read the value of a state, and track it as a dependency */
+		template <typename V>
+		V const& Get(IState<V> const& state)
+		{
+			Node.TrackSource(state);
+			return state.Get();
+		}
+
+		/**
+		 *	@brief
+		 *	Read the value of another computed state, and track it as a dependency. Computed dependencies are not
+		 *	recomputed unless they're read.
+		 */
+		template <typename V>
+		V const& Get(TComputedState<V> const& state)
+		{
+			Node.TrackNode(const_cast<TComputedState<V>&>(state));
+			return state.Get();
+		}
+
+		/** @brief Shorthand for `Get` */
+		template <typename State>
+		decltype(auto) operator () (State const& state)
+		{
+			return Get(state);
+		}
+
+	private:
+		Detail::FComputedNode& Node;
+	};
+
+	/**
+	 *	@brief
+	 *	A read-only state which value is computed from other states. The states read via the `FComputeContext`
+	 *	argument of the compute function are tracked automatically, and they may differ between computations.
+	 *
+	 *	Computed states are lazy. When a dependency changes they're only invalidated, and recomputed when they're
+	 *	read next time. Invalidation is propagated through chains of computed states without recomputing them. This
+	 *	way each computed state recomputes at most once per propagation wave, even with diamond shaped dependencies.
+	 *	Computed states which have `OnChange` listeners are recomputed at the end of the propagation wave (after all
+	 *	their dependencies were invalidated), and notify their listeners only if their value has changed (when it's
+	 *	equality comparable).
+	 *
+	 *	Usage:
+	 *	@code
+	 *	TState<float> Width {2};
+	 *	TState<float> Height {3};
+	 *	TComputedState<float> Area {[this](FComputeContext& use) { return use(Width) * use(Height); }};
+	 *	@endcode
+	 *
+	 *	@warning
+	 *	Computed states are not thread-safe, and their dependencies must outlive them. Only `GetVersion` may be called
+	 *	from other threads.
+	 *
+	 *	@tparam T  The type of the computed value
+	 */
+	template <typename T>
+	class TComputedState : public IState<T>, public Detail::FComputedNode
+	{
+	public:
+		using FComputeFunction = TFunction<T(FComputeContext&)>;
+
+		explicit TComputedState(FComputeFunction&& compute) : Compute(MoveTemp(compute)) {}
+
+		virtual ~TComputedState() override
+		{
+			Detail::FStateWave::Forget(*this);
+		}
+
+		virtual T const& Get() const override
+		{
+			MutableThis()->Refresh();
+			return Value.GetValue().Next;
+		}
+
+		virtual void Set(T const& value) override
+		{
+			ASSERT_QUIT(false, , ->WithMessage(TEXT_"Computed states cannot be set."));
+		}
+
+		virtual void Modify(TUniqueFunction<void(T&)>&& modifier, bool alwaysNotify = true) override
+		{
+			ASSERT_QUIT(false, , ->WithMessage(TEXT_"Computed states cannot be modified."));
+		}
+
+		virtual bool HasChangedFrom(const T& nextValue) override
+		{
+			ASSERT_QUIT(false, false, ->WithMessage(TEXT_"Computed states cannot be set."));
+			return false;
+		}
+
+		virtual bool HasEverChanged() const override { return bEverChanged; }
+
+		/**
+		 *	@brief
+		 *	The version of the last computed value. This doesn't recompute the value (so it stays safe to read from
+		 *	any thread). The version only advances when the value is recomputed, because it was read on the thread
+		 *	owning this state, or because listeners were notified.
+		 */
+		virtual uint64 GetVersion() const override
+		{
+			return Version.Get();
+		}
+
+		virtual bool Remove(FDelegateHandle const& handle) override
+		{
+			return OnChangeEvent.Remove(handle);
+		}
+
+		virtual int32 RemoveAll(const void* object) override
+		{
+			return OnChangeEvent.RemoveAll(object);
+		}
+
+		virtual TTuple<T const&, FStateReadLock> GetOnAnyThread() const override { return { Get(), {} }; }
+		virtual FStateReadLock ReadLock() const override { return {}; }
+		virtual FStateWriteLock WriteLock() override { return {}; }
+
+		virtual TOptional<T> const& GetPrevious() const override
+		{
+			MutableThis()->Refresh();
+			return Value.GetValue().Previous;
+		}
+
+		virtual T const& GetPrevious(T const& fallback) const override
+		{
+			return GetPrevious().Get(fallback);
+		}
+
+		virtual T const& GetPreviousOrCurrent() const override
+		{
+			TOptional<T> const& previous = GetPrevious();
+			return previous.IsSet() ? previous.GetValue() : Get();
+		}
+
+		virtual void NormalizePrevious() override
+		{
+			if constexpr (CCopyable<T>)
+			{
+				Refresh();
+				Value.GetValue().Previous = Value.GetValue().Next;
+			}
+		}
+
+	protected:
+		virtual FDelegateHandle OnChangeImpl(TDelegate<void(TChangeData<T> const&)>&& onChange, FEventPolicy const& eventPolicy = {}) override
+		{
+			// Listeners expect up-to-date values, and they're notified only about changes after this point
+			Refresh();
+			return OnChangeEvent.Add(onChange, eventPolicy);
+		}
+
+		virtual bool HasListeners() const override
+		{
+			return OnChangeEvent.IsBound();
+		}
+
+		virtual void OnWaveEnd() override
+		{
+			if (Refresh())
+			{
+				Detail::FStateWave wave;
+				OnChangeEvent.Broadcast(Value.GetValue());
+			}
+		}
+
+	private:
+		FORCEINLINE TComputedState* MutableThis() const { return const_cast<TComputedState*>(this); }
+
+		/** @return True if the value has changed */
+		bool Refresh()
+		{
+			if (!bDirty) return false;
+			ASSERT_CRASH(!bComputing,
+				->WithMessage(TEXT_"Circular dependency detected while computing a state.")
+			);
+			TGuardValue computingGuard(bComputing, true);
+
+			BeginTracking();
+			FComputeContext context(*this);
+			T next = Compute(context);
+			EndTracking();
+			bDirty = false;
+
+			if (Value.IsSet())
+			{
+				if constexpr (CCoreEqualityComparable<T>)
+				{
+					if (Value.GetValue().Next == next) return false;
+				}
+				bEverChanged = true;
+			}
+
+			TOptional<T> previous;
+			if constexpr (CCopyable<T>)
+			{
+				if (Value.IsSet()) previous = MoveTemp(Value.GetValue().Next);
+			}
+			Value.Emplace(MoveTemp(next));
+			Value.GetValue().Previous = MoveTemp(previous);
+			Version.Increment();
+			return true;
+		}
+
+		FComputeFunction Compute;
+		TEventDelegate<void(TChangeData<T> const&)> OnChangeEvent;
+		TOptional<TChangeData<T>> Value;
+		Detail::FStateVersion Version;
+		bool bComputing = false;
+		bool bEverChanged = false;
+	};
+}
@@ -15,6 +15,7 @@
 #include "Mcro/Slate.h"
 #include "Mcro/AssertMacros.h"
 #include "Mcro/Observable.h"
+#include "Mcro/Observable/CollectionState.h"
 #include "Mcro/Threading.h"
 #include "Mcro/Range.h"
 #include "Mcro/Range/Views.h"
@@ -68,6 +69,7 @@ namespace Mcro::Slate
 			FRemoveChild RemoveChild;
 			TSharedPtr<ContainerWidget> Container;
 			ChildrenRange Children;
+			std::atomic<bool> bUpdateQueued { false };
 			virtual void OnStateChange(Range const& next) = 0;
 			
 			static void DefaultRemoveChild(FRemoveChild& delegate)
@@ -86,37 +88,51 @@ namespace Mcro::Slate
 				}
 			}
 
+			/**
+			 *	Set up the widget with an explicit state, without subscribing to its snapshot notifications. Used by
+			 *	derived widgets which observe collection states via their delta notifications.
+			 */
 			template <CWidgetArguments ThisArguments>
-			requires requires(ThisArguments& args)
-			{
-				{ args._State }       -> CSameAsDecayed< IStatePtr<Range> >;
-				{ args._Container }   -> CSameAsDecayed< TSharedPtr<ContainerWidget> >;
-				{ args._CreateChild } -> CSameAsDecayed< FCreateChild >;
-				{ args._UpdateChild } -> CSameAsDecayed< FUpdateChild >;
-				{ args._RemoveChild } -> CSameAsDecayed< FRemoveChild >;
-			}
-			void ConstructBase(ThisArguments const& args)
+			void ConstructBase(ThisArguments const& args, IStatePtr<Range> const& state)
 			{
 				ASSERT_CRASH(args._Container);
-				ASSERT_CRASH(args._State);
+				ASSERT_CRASH(state);
 				ASSERT_CRASH(args._CreateChild.IsBound());
 				ASSERT_CRASH(args._RemoveChild.IsBound());
 		
 				Container = args._Container;
-				State = args._State.ToWeakPtr();
+				State = state.ToWeakPtr();
 				CreateChild = args._CreateChild;
 				UpdateChild = args._UpdateChild;
 				RemoveChild = args._RemoveChild;
 		
 				ChildSlot[Container.ToSharedRef()];
+			}
+
+			template <CWidgetArguments ThisArguments>
+			requires requires(ThisArguments& args)
+			{
+				{ args._State }       -> CSameAsDecayed< IStatePtr<Range> >;
+				{ args._Container }   -> CSameAsDecayed< TSharedPtr<ContainerWidget> >;
+				{ args._CreateChild } -> CSameAsDecayed< FCreateChild >;
+				{ args._UpdateChild } -> CSameAsDecayed< FUpdateChild >;
+				{ args._RemoveChild } -> CSameAsDecayed< FRemoveChild >;
+			}
+			void ConstructBase(ThisArguments const& args)
+			{
+				ConstructBase(args, args._State);
 
 				args._State->OnChange(this, [this](Range const& next)
 				{
 					if (IsInGameThread()) OnStateChange(next);
-					else
+
+					// Changes from other threads are coalesced without copying the whole collection, at most one
+					// update is queued on the game thread, which reads the latest value of the state when it runs.
+					else if (!bUpdateQueued.exchange(true, std::memory_order_acq_rel))
 					{
 						RunInGameThread(WeakSelf(this), [this]
 						{
+							bUpdateQueued.store(false, std::memory_order_release);
 							if (auto state = State.Pin())
 							{
 								auto [value, lock] = state->GetOnAnyThread();
@@ -154,21 +170,139 @@ namespace Mcro::Slate
 		using FUpdateChild = Base::FUpdateChild;
 		using FRemoveChild = Base::FRemoveChild;
 		using ContainerSlotArguments = Base::ContainerSlotArguments;
+
+		/** Same as `FCreateChild`, but the new slot must be inserted at the given index, instead of being appended */
+		using FInsertChild = FCreateChild;
+		
+		using FMoveChild = TDelegate<void(
+			TSharedRef<ContainerWidget> const& container,
+			TSharedRef<ChildWidget> const& child,
+			int32 from, int32 to
+		)>;
 		
 		SLATE_BEGIN_ARGS(TArrayReactiveWidget)
 			{
 				Base::DefaultRemoveChild(_RemoveChild);
+				DefaultMoveChild(_MoveChild);
 			}
 			SLATE_ARGUMENT(IStatePtr<Base::StateRangeType>, State);
+
+			/**
+			 *	Observe an array state via its individual changes instead of `State`. Children are only created,
+			 *	updated, moved or removed for the affected items. `CreateChild` is only used for the initial items,
+			 *	items inserted later are created with `InsertChild`, which must be bound in this case.
+			 */
+			SLATE_ARGUMENT(TSharedPtr<TArrayState<Item>>, Collection);
 			SLATE_ARGUMENT(TSharedPtr<ContainerWidget>, Container);
 			SLATE_EVENT(FCreateChild, CreateChild);
 			SLATE_EVENT(FUpdateChild, UpdateChild);
 			SLATE_EVENT(FRemoveChild, RemoveChild);
+
+			/** Only used with `Collection`: insert a new slot for an item at the given index of the container */
+			SLATE_EVENT(FInsertChild, InsertChild);
+
+			/**
+			 *	Only used with `Collection`: move the slot of an existing child to another index of the container. By
+			 *	default it's re-inserted via `RemoveSlot` and `InsertSlot` when the container has those (like box
+			 *	panels), which keeps the child widget but not the attributes of its slot.
+			 */
+			SLATE_EVENT(FMoveChild, MoveChild);
 		SLATE_END_ARGS()
 
-		void Construct(FArguments const& args) { Base::ConstructBase(args); }
+		void Construct(FArguments const& args)
+		{
+			if (!args._Collection)
+			{
+				Base::ConstructBase(args);
+				return;
+			}
+			ASSERT_CRASH(args._InsertChild.IsBound(),
+				->WithMessage(TEXT_"InsertChild must be bound when an array reactive widget observes a Collection.")
+				->WithDetails(TEXT_"CreateChild is expected to append slots, it cannot insert items in the middle.")
+			);
+			ASSERT_CRASH(args._MoveChild.IsBound(),
+				->WithMessage(TEXT_"MoveChild must be bound when an array reactive widget observes a Collection.")
+				->WithDetails(TEXT_"It can only be bound automatically for containers with RemoveSlot and InsertSlot.")
+			);
+			InsertChildDelegate = args._InsertChild;
+			MoveChildDelegate = args._MoveChild;
+			
+			Base::ConstructBase(args, args._Collection);
+			args._Collection->OnDelta(this, [this](TArray<Item> const& items, FArrayStateChange const& change)
+			{
+				OnCollectionChange(items, change);
+			});
+			OnStateChange(args._Collection->Get());
+		}
 
 	protected:
+		FInsertChild InsertChildDelegate;
+		FMoveChild MoveChildDelegate;
+
+		static void DefaultMoveChild(FMoveChild& delegate)
+		{
+			if constexpr (requires(ContainerWidget& container, TSharedRef<SWidget> child, int32 at)
+			{
+				container.RemoveSlot(child);
+				container.InsertSlot(at)[child];
+			})
+			{
+				delegate = FMoveChild::CreateLambda([](
+					TSharedRef<ContainerWidget> const& container,
+					TSharedRef<ChildWidget> const& child,
+					int32 from, int32 to
+				) {
+					container->RemoveSlot(child);
+					container->InsertSlot(to)[child];
+				});
+			}
+		}
+
+		void InsertChild(TArray<Item> const& items, int32 index)
+		{
+			typename ContainerWidget::FSlot* newSlot = nullptr;
+			InsertChildDelegate.Execute(Base::Container.ToSharedRef(), items[index], index).Expose(newSlot);
+			Base::Children.Insert(StaticCastSharedRef<ChildWidget>(newSlot->GetWidget()), index);
+		}
+
+		void MoveChild(int32 from, int32 to)
+		{
+			TSharedRef<ChildWidget> child = Base::Children[from];
+			MoveChildDelegate.Execute(Base::Container.ToSharedRef(), child, from, to);
+			Base::Children.RemoveAt(from);
+			Base::Children.Insert(child, to);
+		}
+
+		void RemoveChildAt(int32 index)
+		{
+			Base::RemoveChild.Execute(Base::Container, Base::Children[index], index);
+			Base::Children.RemoveAt(index);
+		}
+
+		void OnCollectionChange(TArray<Item> const& items, FArrayStateChange const& change)
+		{
+			switch (change.Kind)
+			{
+			case EArrayStateChange::Insert:
+				for (int32 i = change.Index; i < change.Index + change.Count; ++i)
+					InsertChild(items, i);
+				break;
+			case EArrayStateChange::Remove:
+				for (int32 i = change.Index + change.Count - 1; i >= change.Index; --i)
+					RemoveChildAt(i);
+				break;
+			case EArrayStateChange::Update:
+				Base::UpdateChild.ExecuteIfBound(Base::Children[change.Index], items[change.Index], change.Index);
+				break;
+			case EArrayStateChange::Move:
+				MoveChild(change.Index, change.To);
+				break;
+			case EArrayStateChange::Reset:
+				OnStateChange(items);
+				break;
+			}
+		}
+
 		virtual void OnStateChange(Base::StateRangeType const& next) override
 		{
 			for (int i = 0; i < FMath::Max(next.Num(), Base::Children.Num()); ++i)
@@ -225,15 +359,61 @@ namespace Mcro::Slate
 				Base::DefaultRemoveChild(_RemoveChild);
 			}
 			SLATE_ARGUMENT(IStatePtr<Base::StateRangeType>, State);
+
+			/**
+			 *	Observe a map state via its individual changes instead of `State`. Children are only created,
+			 *	updated or removed for the affected keys.
+			 */
+			SLATE_ARGUMENT(TSharedPtr<TMapState<Key, Item>>, Collection);
 			SLATE_ARGUMENT(TSharedPtr<ContainerWidget>, Container);
 			SLATE_EVENT(FCreateChild, CreateChild);
 			SLATE_EVENT(FUpdateChild, UpdateChild);
 			SLATE_EVENT(FRemoveChild, RemoveChild);
 		SLATE_END_ARGS()
 
-		void Construct(FArguments const& args) { Base::ConstructBase(args); }
+		void Construct(FArguments const& args)
+		{
+			if (!args._Collection)
+			{
+				Base::ConstructBase(args);
+				return;
+			}
+			Base::ConstructBase(args, args._Collection);
+			args._Collection->OnDelta(this, [this](TMap<Key, Item> const& items, TMapStateChange<Key> const& change)
+			{
+				OnCollectionChange(items, change);
+			});
+			OnStateChange(args._Collection->Get());
+		}
 
 	protected:
+		void OnCollectionChange(TMap<Key, Item> const& items, TMapStateChange<Key> const& change)
+		{
+			switch (change.Kind)
+			{
+			case EMapStateChange::Add:
+				{
+					typename ContainerWidget::FSlot* newSlot = nullptr;
+					Base::CreateChild.Execute(Base::Container, items[*change.Key], *change.Key).Expose(newSlot);
+					Base::Children.Add(*change.Key, StaticCastSharedRef<ChildWidget>(newSlot->GetWidget()));
+					break;
+				}
+			case EMapStateChange::Remove:
+				if (TSharedRef<ChildWidget> const* child = Base::Children.Find(*change.Key))
+				{
+					Base::RemoveChild.Execute(Base::Container, *child, *change.Key);
+					Base::Children.Remove(*change.Key);
+				}
+				break;
+			case EMapStateChange::Update:
+				Base::UpdateChild.ExecuteIfBound(Base::Children[*change.Key], items[*change.Key], *change.Key);
+				break;
+			case EMapStateChange::Reset:
+				OnStateChange(items);
+				break;
+			}
+		}
+
 		virtual void OnStateChange(Base::StateRangeType const& next) override
 		{
 			auto update = next